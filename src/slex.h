@@ -25,38 +25,21 @@
 #ifndef SLEX_H
 #define SLEX_H
 
-typedef unsigned long      slex_u32;
-typedef long               slex_i32;
+// Only for size_t, lengths and locations are 64-bit on 64-bit targets.
+#include <stddef.h>
+
+typedef unsigned int       slex_u32;
+typedef int                slex_i32;
 typedef unsigned long long slex_u64;
 typedef long long          slex_i64;
 typedef int                slex_bool;
 
-/* CONFIG */
-
-// Whether to return SLEX_TOK_eof when at the end.
-#ifndef SLEX_END_IS_TOKEN
-#define SLEX_END_IS_TOKEN 1
-#endif
-
-// Whether to add support for some CXX specific tokens.
-#ifndef SLEX_CXX_SUPPORT
-#define SLEX_CXX_SUPPORT 1
-#endif
-
-// Whether to parse int suffixes as a part of the token.
-#ifndef SLEX_INT_SUFFIXES
-#define SLEX_INT_SUFFIXES 1
-#endif
-
-// Whether to skip the current line when # is encountered.
-#ifndef SLEX_SKIP_PREPROCESSOR
-#define SLEX_SKIP_PREPROCESSOR 0
-#endif
-
 typedef enum {
   SLEX_ERR_unknown_tok,      // Token unrecognised
   SLEX_ERR_parse,            // Token recognised, but contains an error 
   SLEX_ERR_storage,          // Not enough storage for token (int literal too big, string larger than string store, ...)
+  SLEX_ERR_need_input,       // The token may continue past stream_end, more input is needed (see stream_is_partial)
+  SLEX_ERR_would_block,      // The budget ran out before the token ended (see slex_get_next_token_budgeted)
 
   SLEX_TOK_eof,              // End of File (returned when SLEX_END_IS_TOKEN is enabled)
   SLEX_TOK_str_lit,          // String Literal ("hello, world\n", "abc\0", ...)
@@ -115,28 +98,282 @@ typedef enum {
   SLEX_TOK_token_concat,     // Token Concatenation (##)
   SLEX_TOK_backslash,        // Backslash used for macros (\)
   SLEX_TOK_preprocessor_at,  // Preprocessor At (#@)
-#if SLEX_CXX_SUPPORT
+  // Only produced by lexers built with SLEX_CXX_SUPPORT
   SLEX_TOK_member_access,    // Member Access via Pointer to Member (.*)
   SLEX_TOK_deref_access,     // Dereference Access via Pointer to Member (->*)
   SLEX_TOK_scope_resolution, // Scope Resolution (::)
-#endif
+  // Only produced by lexers built with SLEX_EMIT_TRIVIA
+  SLEX_TOK_whitespace,       // Run of whitespace characters
+  SLEX_TOK_comment,          // Comment (// ..., /* ... */)
+  SLEX_TOK_doc_comment,      // Documentation comment (/// ..., /** ... */)
 } TokenType;
 
 typedef struct {
   char *parse_point;
   char *stream_end;
   char *string_store;
-  int string_store_len;
+  size_t string_store_len;
+  // Set when more input follows stream_end. Tokens that could continue past stream_end
+  // are then not returned; slex_get_next_token fails with SLEX_ERR_need_input and leaves
+  // parse_point where the token starts. Append the input and call it again.
+  slex_bool stream_is_partial;
+  // Work done by the lexer: bytes walked plus one per call. Every scanning loop moves
+  // forward, so this bounds the real work. Only counted with SLEX_COUNT_STEPS.
+  slex_u64 steps;
+  // Where slex_get_next_token_budgeted stopped inside a long token, comment or skipped
+  // directive: what it was scanning, where that starts and how far it got, and in a number
+  // the significant digits of its current part.
+  int resume_state;
+  char *resume_start;
+  char *resume_point;
+  size_t resume_digits;
 
   int tok_ty;
   char *first_tok_char;
   char *last_tok_char;
-  int str_len;
+  size_t str_len;
   unsigned long long parsed_int_lit;
   double parsed_float_lit;
 } SlexContext;
 
-#ifdef __cplusplus
+// Incremental line and column lookup, see slex_get_location.
+typedef struct {
+  char *stream_begin;
+  char *pos;
+  size_t line_num;
+  size_t col_num;
+} SlexLocation;
+
+// A token kept around after the context moved on.
+typedef struct {
+  int tok_ty;
+  char *first_tok_char;
+  char *last_tok_char;
+} SlexToken;
+
+// One input of slex_tokenize_batch.
+typedef struct {
+  char *begin;
+  size_t len;
+} SlexInput;
+
+// The tokens and status of one input of slex_tokenize_batch.
+typedef struct {
+  size_t first_token;  // index of the first token in the shared token buffer
+  size_t token_count;
+  int status;          // SLEX_TOK_eof if the whole input was lexed, otherwise the error that stopped it
+  size_t error_offset; // where the error was detected, relative to the input
+} SlexBatchResult;
+
+// Largest k-gram and winnowing window of a SlexFingerprinter.
+#define SLEX_FINGERPRINT_MAX 64
+// Multiplier of the rolling hash (the hash wraps around modulo 2^64).
+#define SLEX_FINGERPRINT_BASE 0x100000001B3ull
+
+// A winnowed fingerprint: the hash of k normalized tokens and where the first one starts.
+typedef struct {
+  slex_u64 hash;
+  size_t offset;
+} SlexFingerprint;
+
+// Rolling hash and winnowing state of slex_fingerprint, kept between calls.
+typedef struct {
+  char *stream_begin;
+  size_t k;
+  size_t window;
+  slex_u64 base_pow;   // base^(k-1), for removing the oldest token from the hash
+  slex_u64 hash;
+  size_t token_count;
+  slex_u64 token_values[SLEX_FINGERPRINT_MAX];
+  size_t token_offsets[SLEX_FINGERPRINT_MAX];
+  size_t gram_count;
+  slex_u64 gram_hashes[SLEX_FINGERPRINT_MAX];
+  size_t gram_offsets[SLEX_FINGERPRINT_MAX];
+  size_t last_pick;    // index of the last k-gram emitted
+  slex_bool done;
+} SlexFingerprinter;
+
+// A preprocessor directive found by slex_next_directive. All pointers point into the input.
+typedef struct {
+  char *first_char;    // the #
+  char *name;          // include, if, ifdef, endif, define, ...
+  size_t name_len;
+  // For #include: the path without its delimiters. Otherwise: the rest of the line
+  // (line splices included) without surrounding whitespace.
+  char *args;
+  size_t args_len;
+  int include_kind;    // '<' or '"' for #include <...> and #include "...", 0 otherwise
+  size_t depth;        // #if nesting: the same for an #if, its #elif/#else and its #endif
+} SlexDirective;
+
+// State of slex_next_directive.
+typedef struct {
+  char *stream_begin;
+  char *parse_point;
+  char *stream_end;
+  size_t depth;
+  // Just past the last block comment that had only blanks and comments before it on its line.
+  char *comment_end;
+} SlexDirectiveScanner;
+
+#define SLEX_CAT_(a, b) a##b
+#define SLEX_CAT(a, b) SLEX_CAT_(a, b)
+#define SLEX_FN(name) SLEX_CAT(SLEX_PREFIX, name)
+
+// A token (or error) that ends closer than this to the end of a partial stream may change
+// with more input. It covers the lexer's lookahead (<<=, \U0010FFFF) with room to spare.
+#define SLEX_PARTIAL_MARGIN 16
+
+// Bytes that have to be readable after stream_end with SLEX_PADDED_INPUT: a '\0' and
+// room for the widest vector load.
+#define SLEX_PADDING 64
+
+// Internal functions are constexpr in C++20, so instances can also run at compile time (see slex.hpp).
+#if defined(__cplusplus) && __cplusplus >= 202002L
+#define SLEX_CONSTEXPR constexpr
+#else
+#define SLEX_CONSTEXPR
+#endif
+
+#endif // SLEX_H
+
+/* INSTANCES
+ *
+ * Everything below this point is compiled once per lexer instance. By default the
+ * header declares a single instance with the slex_ prefix (slex_get_next_token, ...)
+ * using the CONFIG macros below.
+ *
+ * To link several differently configured lexers into one program, define SLEX_PREFIX
+ * together with the CONFIG macros before each inclusion:
+ *
+ *   #define SLEX_PREFIX slex_c_
+ *   #define SLEX_CXX_SUPPORT 0
+ *   #include "slex.h"        // slex_c_init_context, slex_c_get_next_token, ...
+ *
+ *   #define SLEX_PREFIX slex_cxx_
+ *   #include "slex.h"        // slex_cxx_init_context, slex_cxx_get_next_token, ...
+ *
+ * Every inclusion consumes SLEX_PREFIX and the CONFIG macros (they are undefined
+ * again at the end), so the next instance picks its own configuration. The options stay
+ * compile time constants, so each instance is as fast as a single configured lexer.
+ * All instances share SlexContext and TokenType.
+ *
+ * Defining SLEX_CONSTEXPR_INSTANCE (C++20 only) together with SLEX_PREFIX implements the
+ * instance in the current translation unit with static constexpr functions, so it can
+ * lex at compile time. slex.hpp uses this.
+ */
+#if defined(SLEX_PREFIX) || !defined(SLEX_DEFAULT_INSTANCE)
+
+#ifndef SLEX_PREFIX
+#define SLEX_DEFAULT_INSTANCE
+#define SLEX_PREFIX slex_
+#endif
+
+/* CONFIG */
+
+// Whether to return SLEX_TOK_eof when at the end.
+#ifndef SLEX_END_IS_TOKEN
+#define SLEX_END_IS_TOKEN 1
+#endif
+
+// Whether to add support for some CXX specific tokens.
+#ifndef SLEX_CXX_SUPPORT
+#define SLEX_CXX_SUPPORT 1
+#endif
+
+// Whether to parse int suffixes as a part of the token.
+#ifndef SLEX_INT_SUFFIXES
+#define SLEX_INT_SUFFIXES 1
+#endif
+
+// Whether to skip the current line when # is encountered.
+#ifndef SLEX_SKIP_PREPROCESSOR
+#define SLEX_SKIP_PREPROCESSOR 0
+#endif
+
+// Whether to only validate and delimit literals while lexing. parsed_int_lit, parsed_float_lit,
+// str_len and string_store are then left alone; the values are computed on demand with
+// slex_token_int_value, slex_token_float_value and slex_token_decode_string.
+// Errors that depend on the value (SLEX_ERR_storage) are reported by those functions instead.
+#ifndef SLEX_LAZY_LITERALS
+#define SLEX_LAZY_LITERALS 0
+#endif
+
+// Whether to count the work done by slex_get_next_token in context->steps (for benchmarks
+// and the performance fuzzer).
+#ifndef SLEX_COUNT_STEPS
+#define SLEX_COUNT_STEPS 0
+#endif
+
+// Whether the caller guarantees SLEX_PADDING readable bytes after stream_end, the first of
+// them '\0' (slex_map_file in slex_pipeline.h maps files like that). The hot loops then
+// stop on the '\0' instead of checking the bounds on every character, and comments are
+// searched word at a time without a byte by byte tail.
+#ifndef SLEX_PADDED_INPUT
+#define SLEX_PADDED_INPUT 0
+#endif
+
+// Whether to return whitespace and comments as tokens instead of skipping them.
+// Trivia tokens point into the stream like every other token, so concatenating
+// all tokens reproduces the input (except lines skipped by SLEX_SKIP_PREPROCESSOR).
+#ifndef SLEX_EMIT_TRIVIA
+#define SLEX_EMIT_TRIVIA 0
+#endif
+
+#ifdef SLEX_CONSTEXPR_INSTANCE
+#define SLEX_DEF static constexpr
+#else
+#define SLEX_DEF
+#endif
+
+// Whether the n characters at parse_point can be read. Padded input leaves the check out
+// where the '\0' at stream_end fails the character test that follows anyway.
+#if SLEX_PADDED_INPUT
+#define SLEX_AVAIL(ctx, n) 1
+#else
+#define SLEX_AVAIL(ctx, n) ((ctx)->stream_end - (ctx)->parse_point >= (n))
+#endif
+
+// Per instance names. Functions that depend on the CONFIG macros are renamed
+// with SLEX_PREFIX, so several instances don't collide.
+#define slex_init_context SLEX_FN(init_context)
+#define slex_get_next_token SLEX_FN(get_next_token)
+#define slex_get_next_token_budgeted SLEX_FN(get_next_token_budgeted)
+#define slex_scan_number SLEX_FN(scan_number)
+#define slex_tokenize_budgeted SLEX_FN(tokenize_budgeted)
+#define slex_skip_balanced SLEX_FN(skip_balanced)
+#define slex_tokenize_batch SLEX_FN(tokenize_batch)
+#define slex_init_fingerprinter SLEX_FN(init_fingerprinter)
+#define slex_fingerprint SLEX_FN(fingerprint)
+#define slex_init_directive_scanner SLEX_FN(init_directive_scanner)
+#define slex_next_directive SLEX_FN(next_directive)
+#define slex_minify SLEX_FN(minify)
+#define slex_lex_token SLEX_FN(lex_token)
+#define slex_get_token_location SLEX_FN(get_token_location)
+#define slex_get_parse_ptr_location SLEX_FN(get_parse_ptr_location)
+#define slex_init_location SLEX_FN(init_location)
+#define slex_get_location SLEX_FN(get_location)
+#define slex_return_eof SLEX_FN(return_eof)
+#define slex_parse_punctuator SLEX_FN(parse_punctuator)
+#define slex_skip SLEX_FN(skip)
+#define slex_parse_int_lit SLEX_FN(parse_int_lit)
+#define slex_parse_whitespace SLEX_FN(parse_whitespace)
+#define slex_parse_comment SLEX_FN(parse_comment)
+#define slex_comment_type SLEX_FN(comment_type)
+#define slex_token_int_value SLEX_FN(token_int_value)
+#define slex_token_float_value SLEX_FN(token_float_value)
+#define slex_token_decode_string SLEX_FN(token_decode_string)
+#define slex_delimit_exponent SLEX_FN(delimit_exponent)
+#define slex_delimit_number SLEX_FN(delimit_number)
+#define slex_delimit_char_or_str_lit SLEX_FN(delimit_char_or_str_lit)
+#define slex_continue_delimit_char_or_str_lit SLEX_FN(continue_delimit_char_or_str_lit)
+#define slex_parse_int_suffix SLEX_FN(parse_int_suffix)
+#define slex_try_match SLEX_FN(try_match)
+#define slex_parse_ident SLEX_FN(parse_ident)
+#define slex_parse_exponent SLEX_FN(parse_exponent)
+#define slex_extend_to_float SLEX_FN(extend_to_float)
+
+#if defined(__cplusplus) && !defined(SLEX_CONSTEXPR_INSTANCE)
 extern "C" {
 #endif
 
@@ -148,15 +385,156 @@ extern "C" {
 // - stream_end: Pointer to the character just past the last character in the stream (or to EOF).
 // - string_store: Pointer to the storage used for parsing strings.
 // - string_store_len: Specifies the length of string_store.
-void slex_init_context(SlexContext *context, char *stream_start, char *stream_end, char* string_store, int string_store_len);
+SLEX_DEF void slex_init_context(SlexContext *context, char *stream_start, char *stream_end, char* string_store, size_t string_store_len);
 
 // Description:
-// - This function parses a token and advances context->parse_ptr.
+// - This function parses a token and advances context->parse_ptr. Identifiers may contain
+//   UTF-8 encoded XID_Start and XID_Continue characters (C23, C++). A run of other non-ASCII
+//   bytes is one SLEX_ERR_unknown_tok from context->first_tok_char to context->last_tok_char,
+//   with parse_ptr on its last byte, so skipping a character after the error skips all of it.
 // Parameters:
 // - context: The context needed for tokenizing.
 // Returns:
 // - Returns 1 if a token was parsed successfully; otherwise, returns a non-zero value.
-int slex_get_next_token(SlexContext *context);
+SLEX_DEF int slex_get_next_token(SlexContext *context);
+
+// Description:
+// - This function is slex_get_next_token with a bound on the work of one call. It walks at
+//   most *byte_budget bytes (plus a few to finish an escape sequence or a punctuator) and
+//   subtracts them from it. When the budget runs out inside a comment, literal, number,
+//   identifier, whitespace or a directive skipped by SLEX_SKIP_PREPROCESSOR, it fails with
+//   SLEX_ERR_would_block and keeps how far it got in the context, with parse_point left at
+//   where that starts. The next call continues from there, so the tokens are the same as
+//   without a budget. A literal's characters stay in string_store between the calls.
+//   A number is lexed once more in the call that finds its end, and that is charged too.
+//   On a partial stream the progress is kept the same way for SLEX_ERR_need_input.
+// Parameters:
+// - context: The context needed for tokenizing.
+// - byte_budget: The bytes left to walk, updated on return.
+// Returns:
+// - Returns 1 if a token was parsed successfully; otherwise, returns 0.
+SLEX_DEF int slex_get_next_token_budgeted(SlexContext *context, size_t *byte_budget);
+
+// Description:
+// - This function lexes tokens into tokens until the stream ends, token_cap tokens were
+//   written or byte_budget bytes were walked (see slex_get_next_token_budgeted).
+// Parameters:
+// - context: The context needed for tokenizing.
+// - tokens: Output buffer for the tokens.
+// - token_cap: Capacity of tokens.
+// - byte_budget: The most bytes to walk.
+// - token_count: Output pointer for the number of tokens written.
+// Returns:
+// - Returns 1 at the end of the stream. Returns 0 when a budget ran out (context->tok_ty is
+//   SLEX_ERR_would_block; call it again to continue), a partial stream needs input or the
+//   lexer fails.
+SLEX_DEF int slex_tokenize_budgeted(SlexContext *context, SlexToken *tokens, size_t token_cap, size_t byte_budget, size_t *token_count);
+
+// Description:
+// - This function skips a balanced region without tokenizing it. It has to be called right
+//   after slex_get_next_token returned {, ( or [. Only brackets of the same kind are counted;
+//   string literals, character literals and comments are skipped so brackets inside them
+//   don't count. Errors inside the region (like an invalid escape sequence) are not reported.
+//   On success the token spans the whole region: context->first_tok_char points to the opener,
+//   context->last_tok_char to the matching closer and context->tok_ty is left unchanged.
+//   The body can be lexed later with a context initialized to (first_tok_char + 1, last_tok_char).
+// Parameters:
+// - context: The parsing context.
+// Returns:
+// - Returns 1 if the matching closer was found; otherwise, returns 0 (SLEX_ERR_parse).
+SLEX_DEF int slex_skip_balanced(SlexContext *context);
+
+// Description:
+// - This function tokenizes many small inputs in one call. The tokens of all inputs are
+//   written one after another into tokens; results[i] tells which of them belong to
+//   inputs[i] and whether it was lexed completely. An input stops at its first error, which
+//   is recorded in its result, and the batch goes on with the next input. The end of an input
+//   is not stored as a token. One context and string_store serve the whole batch (literal
+//   values can be recomputed with slex_token_int_value and friends).
+//   When tokens is full, the batch stops before the input that didn't fit so it can be passed
+//   to the next call. If even the first input doesn't fit, its tokens are cut off and its
+//   status is SLEX_ERR_storage.
+// Parameters:
+// - inputs: The inputs.
+// - input_count: Number of inputs.
+// - tokens: Output buffer for the tokens.
+// - token_cap: Capacity of tokens.
+// - results: Output with room for input_count results.
+// - string_store: Pointer to the storage used for parsing strings.
+// - string_store_len: Specifies the length of string_store.
+// Returns:
+// - Returns the number of inputs done, input_count unless tokens ran out.
+SLEX_DEF size_t slex_tokenize_batch(const SlexInput *inputs, size_t input_count, SlexToken *tokens, size_t token_cap, SlexBatchResult *results, char *string_store, size_t string_store_len);
+
+// Description:
+// - This function initializes the state of slex_fingerprint.
+// Parameters:
+// - fingerprinter: The struct to be initialized.
+// - stream_begin: Pointer from where the fingerprint offsets are counted.
+// - k: Number of tokens hashed together (1 to SLEX_FINGERPRINT_MAX).
+// - window: Number of consecutive k-grams a fingerprint is picked from (1 to SLEX_FINGERPRINT_MAX).
+SLEX_DEF void slex_init_fingerprinter(SlexFingerprinter *fingerprinter, char *stream_begin, size_t k, size_t window);
+
+// Description:
+// - This function lexes the rest of the stream and computes winnowed fingerprints for clone
+//   detection in the same pass. Tokens are normalized first: identifiers and keywords hash
+//   alike, as do all literals, so renamed copies get the same fingerprints. A rolling hash
+//   covers every k consecutive tokens, and of every window consecutive hashes the smallest
+//   (the rightmost on ties) is written to out, once. A stream with fewer than window k-grams
+//   gets the smallest of them. Whitespace, comments and characters the lexer rejects are skipped.
+// Parameters:
+// - context: The parsing context.
+// - fingerprinter: The state, initialized with slex_init_fingerprinter.
+// - out: Output buffer for the fingerprints.
+// - out_cap: Capacity of out.
+// - out_len: Output pointer for the number of fingerprints written.
+// Returns:
+// - Returns 1 at the end of the stream. Returns 0 when out is full (context->tok_ty is
+//   SLEX_ERR_storage) or a partial stream needs input (SLEX_ERR_need_input); call it again
+//   to continue.
+SLEX_DEF int slex_fingerprint(SlexContext *context, SlexFingerprinter *fingerprinter, SlexFingerprint *out, size_t out_cap, size_t *out_len);
+
+// Description:
+// - This function initializes a scanner for slex_next_directive.
+// Parameters:
+// - scanner: The struct to be initialized.
+// - stream_start: Pointer to the first character in the stream.
+// - stream_end: Pointer to the character just past the last character in the stream.
+SLEX_DEF void slex_init_directive_scanner(SlexDirectiveScanner *scanner, char *stream_start, char *stream_end);
+
+// Description:
+// - This function finds the next preprocessor directive, much faster than lexing every token.
+//   It skips the input word at a time, only stopping for # and for the characters that can
+//   start a comment or a literal (a # inside them isn't a directive), and only lexes lines
+//   where nothing but blanks and comments comes before the #. Directives without a name
+//   (# alone, # 12 "file") are skipped.
+// Parameters:
+// - scanner: The scanner.
+// - directive: Output for the directive.
+// Returns:
+// - Returns 1 if a directive was found; otherwise (end of the stream) returns 0.
+SLEX_DEF int slex_next_directive(SlexDirectiveScanner *scanner, SlexDirective *directive);
+
+// Description:
+// - This function minifies the rest of the stream into out in one pass. Comments are dropped
+//   and the tokens are written as they are, separated only where they would otherwise run
+//   together: by a space, or by a newline that ends a preprocessor directive if
+//   keep_directive_lines is set. Lexing the output gives the same tokens as lexing the input.
+//   With keep_directive_lines every directive is also on its own line, its line splices stay,
+//   and the space after the name of an object-like macro (#define N (1)) is kept, so the
+//   output preprocesses like the input. Without it, the output is a single line.
+//   The output is never longer than the input.
+// Parameters:
+// - context: The parsing context, at the start of what to minify. The stream must be complete.
+// - out: Output buffer.
+// - out_cap: Capacity of out.
+// - keep_directive_lines: Whether to keep preprocessor directives on lines of their own.
+// - out_len: Output pointer for the number of bytes written.
+// Returns:
+// - Returns 1 at the end of the stream. Returns 0 if the lexer fails (context->tok_ty and
+//   context->parse_point tell the error) or out is full (SLEX_ERR_storage); out_len then
+//   covers the tokens before it.
+SLEX_DEF int slex_minify(SlexContext *context, char *out, size_t out_cap, int keep_directive_lines, size_t *out_len);
 
 // Description:
 // - This function retrieves the location of the last token.
@@ -165,7 +543,7 @@ int slex_get_next_token(SlexContext *context);
 // - stream_begin: Pointer to the location from where the lines and columns are counted.
 // - line_num: Output pointer for the line number.
 // - col_num: Output pointer for the column number.
-void slex_get_token_location(SlexContext *context, char *stream_begin, int *line_num, int *col_num);
+SLEX_DEF void slex_get_token_location(const SlexContext *context, char *stream_begin, size_t *line_num, size_t *col_num);
 
 // Description:
 // - This function returns the current location of the parsing point.
@@ -176,69 +554,117 @@ void slex_get_token_location(SlexContext *context, char *stream_begin, int *line
 // - stream_begin: Pointer to the location from where the lines and columns are counted.
 // - line_num: Output pointer for the line number.
 // - col_num: Output pointer for the column number.
-void slex_get_parse_ptr_location(SlexContext *context, char *stream_begin, int *line_num, int *col_num);
+SLEX_DEF void slex_get_parse_ptr_location(const SlexContext *context, char *stream_begin, size_t *line_num, size_t *col_num);
 
-#ifdef __cplusplus
+// Description:
+// - This function initializes an incremental location lookup.
+// Parameters:
+// - location: The struct to be initialized.
+// - stream_begin: Pointer to the location from where the lines and columns are counted.
+SLEX_DEF void slex_init_location(SlexLocation *location, char *stream_begin);
+
+// Description:
+// - This function retrieves the line and column of target. Unlike slex_get_token_location,
+//   it continues from the previous lookup, so asking for increasing positions (like every
+//   token or every error of a stream) takes linear time in total.
+// Parameters:
+// - location: The lookup state.
+// - target: Pointer to the character to locate.
+// - line_num: Output pointer for the line number.
+// - col_num: Output pointer for the column number.
+SLEX_DEF void slex_get_location(SlexLocation *location, char *target, size_t *line_num, size_t *col_num);
+
+// Description:
+// - This function computes the value of a stored int literal token.
+// Parameters:
+// - token: The token, its tok_ty has to be SLEX_TOK_int_lit.
+// - value: Output pointer for the value.
+// Returns:
+// - Returns 1 on success; otherwise (wrong token type, value doesn't fit) returns 0.
+SLEX_DEF int slex_token_int_value(const SlexToken *token, unsigned long long *value);
+
+// Description:
+// - This function computes the value of a stored float literal token.
+// Parameters:
+// - token: The token, its tok_ty has to be SLEX_TOK_float_lit.
+// - value: Output pointer for the value.
+// Returns:
+// - Returns 1 on success; otherwise (wrong token type, value doesn't fit) returns 0.
+SLEX_DEF int slex_token_float_value(const SlexToken *token, double *value);
+
+// Description:
+// - This function decodes a stored string or character literal token (UTF-8 encoded).
+// Parameters:
+// - token: The token, its tok_ty has to be SLEX_TOK_str_lit or SLEX_TOK_char_lit.
+// - string_store: Pointer to the storage for the decoded bytes.
+// - string_store_len: Specifies the length of string_store.
+// - str_len: Output pointer for the decoded length in bytes.
+// Returns:
+// - Returns 1 on success; otherwise (wrong token type, not enough storage) returns 0.
+SLEX_DEF int slex_token_decode_string(const SlexToken *token, char *string_store, size_t string_store_len, size_t *str_len);
+
+#if defined(__cplusplus) && !defined(SLEX_CONSTEXPR_INSTANCE)
 }
 #endif
 
-#ifdef SLEX_IMPLEMENTATION
-
-static inline slex_bool slex_is_numeric(char c) {
+#if defined(SLEX_IMPLEMENTATION) || defined(SLEX_CONSTEXPR_INSTANCE)
+
+// Helpers that don't depend on the CONFIG macros are shared by all instances.
+#ifndef SLEX_COMMON_IMPLEMENTATION
+#define SLEX_COMMON_IMPLEMENTATION
+
+// What slex_get_next_token_budgeted stopped inside of (SlexContext.resume_state).
+enum {
+  SLEX_RESUME_none,
+  SLEX_RESUME_space,
+  SLEX_RESUME_line_comment,
+  SLEX_RESUME_block_comment,
+  SLEX_RESUME_directive,
+  SLEX_RESUME_literal,
+  SLEX_RESUME_ident,
+  SLEX_RESUME_non_ascii,     // a run of non-ASCII characters that aren't an identifier
+  // the phases of a number
+  SLEX_RESUME_number,
+  SLEX_RESUME_fraction,
+  SLEX_RESUME_exponent,
+  SLEX_RESUME_suffix,
+};
+
+static SLEX_CONSTEXPR inline slex_bool slex_is_numeric(char c) {
   return c >= '0' && c <= '9';
 }
 
-static inline slex_bool slex_is_oct(char c) {
+static SLEX_CONSTEXPR inline slex_bool slex_is_oct(char c) {
   return c >= '0' && c <= '7';
 }
 
-static inline slex_bool slex_is_hex(char c) {
+static SLEX_CONSTEXPR inline slex_bool slex_is_hex(char c) {
   return slex_is_numeric(c) || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f');
 }
 
-static inline int slex_hex_to_int(char c) {
+static SLEX_CONSTEXPR inline int slex_hex_to_int(char c) {
   if(slex_is_numeric(c)) return c - '0';
   if(c >= 'A' && c <= 'F') return c - 'A' + 10;
   return c - 'a' + 10;
 }
 
-static inline slex_bool slex_is_whitespace(char c) {
+static SLEX_CONSTEXPR inline slex_bool slex_is_whitespace(char c) {
   return c == ' '  || c == '\t' || c == '\n' || c == '\v' || 
     c == '\f' || c == '\r';
 }
 
-static inline slex_bool slex_is_ident(char c) {
+static SLEX_CONSTEXPR inline slex_bool slex_is_ident(char c) {
   return slex_is_numeric(c) || (c >= 'A' && c <= 'Z') ||
     (c >= 'a' && c <= 'z') || c == '_';
 }
 
-static inline slex_bool slex_return_err(int err_ty, SlexContext *ctx) {
+static SLEX_CONSTEXPR inline slex_bool slex_return_err(int err_ty, SlexContext *ctx) {
   ctx->last_tok_char = ctx->parse_point;
   ctx->tok_ty = err_ty;
   return 0;
 }
 
-static void slex_parse_int_suffix(SlexContext *ctx) {
-  while(ctx->parse_point < ctx->stream_end) {
-    char c = *ctx->parse_point;
-    if(!(c >= 'a' && c <= 'z') && !(c >= 'A' && c <= 'Z')) break;
-    ctx->parse_point++;
-  }
-  ctx->last_tok_char = ctx->parse_point - 1;
-}
-
-static slex_bool slex_return_eof(SlexContext *ctx) {
-#if SLEX_END_IS_TOKEN
-  ctx->tok_ty = SLEX_TOK_eof;
-  ctx->first_tok_char = ctx->stream_end;
-  ctx->last_tok_char = ctx->stream_end;
-  return 1;
-#else
-  return slex_return_err(SLEX_ERR_unknown_tok, ctx);
-#endif
-}
-
-static slex_bool slex_consume_single_char(SlexContext *ctx, TokenType ty)  {
+static SLEX_CONSTEXPR slex_bool slex_consume_single_char(SlexContext *ctx, TokenType ty)  {
   ctx->tok_ty = ty;
   ctx->first_tok_char = ctx->parse_point;
   ctx->last_tok_char = ctx->first_tok_char;
@@ -246,32 +672,208 @@ static slex_bool slex_consume_single_char(SlexContext *ctx, TokenType ty)  {
   return 1;
 }
 
-static slex_bool slex_try_match(SlexContext *ctx, TokenType match_ty, const char *tok, int tok_len) {
-  if (ctx->parse_point > ctx->stream_end - tok_len) 
-    return 0;
+static SLEX_CONSTEXPR slex_bool slex_mul_overflows_u64(slex_u64 a, slex_u64 b) {
+  return a != 0 && b != 0 && a > 0xFFFFFFFFFFFFFFFF / b;
+}
 
-  for (int i = 0; i < tok_len; i++) {
-    if (ctx->parse_point[i] != tok[i]) {
-      return 0;
+static SLEX_CONSTEXPR slex_bool slex_add_overflows_u64(slex_u64 a, slex_u64 b) {
+  return a > 0xFFFFFFFFFFFFFFFF - b;
+}
+
+// Word at a time scanning. The byte assembly is compiled to a single unaligned load.
+static SLEX_CONSTEXPR inline slex_u64 slex_load_u64(const char *p) {
+  return (slex_u64)(unsigned char)p[0] | (slex_u64)(unsigned char)p[1] << 8 |
+    (slex_u64)(unsigned char)p[2] << 16 | (slex_u64)(unsigned char)p[3] << 24 |
+    (slex_u64)(unsigned char)p[4] << 32 | (slex_u64)(unsigned char)p[5] << 40 |
+    (slex_u64)(unsigned char)p[6] << 48 | (slex_u64)(unsigned char)p[7] << 56;
+}
+
+// Non-zero if any byte of w equals c.
+static SLEX_CONSTEXPR inline slex_u64 slex_word_has(slex_u64 w, char c) {
+  slex_u64 x = w ^ (0x0101010101010101ULL * (unsigned char)c);
+  return (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL;
+}
+
+// Returns a pointer to the first a or b in [p, end) or end.
+static SLEX_CONSTEXPR char *slex_find_either(char *p, char *end, char a, char b) {
+  while(end - p >= 8) {
+    slex_u64 w = slex_load_u64(p);
+    if(slex_word_has(w, a) | slex_word_has(w, b)) break;
+    p += 8;
+  }
+  while(p < end && *p != a && *p != b) p++;
+  return p;
+}
+
+// Same as slex_find_either for padded input: whole words are read, also past end.
+static SLEX_CONSTEXPR inline char *slex_find_either_padded(char *p, char *end, char a, char b) {
+  for(;;) {
+    slex_u64 w = slex_load_u64(p);
+    if(slex_word_has(w, a) | slex_word_has(w, b)) break;
+    p += 8;
+    if(p >= end) return end;
+  }
+  while(*p != a && *p != b) p++;
+  return p < end ? p : end;
+}
+
+// Returns a pointer to the first character in [p, end) that can start a directive, a comment
+// or a literal, or end.
+static SLEX_CONSTEXPR char *slex_find_directive_special(char *p, char *end) {
+  while(end - p >= 8) {
+    slex_u64 w = slex_load_u64(p);
+    if(slex_word_has(w, '#') | slex_word_has(w, '/') | slex_word_has(w, '"') | slex_word_has(w, '\'')) break;
+    p += 8;
+  }
+  while(p < end && *p != '#' && *p != '/' && *p != '"' && *p != '\'') p++;
+  return p;
+}
+
+// Returns the end of the logical line starting at p (its \n or end); line splices continue it.
+static SLEX_CONSTEXPR char *slex_find_line_end(char *p, char *end) {
+  for(;;) {
+    p = slex_find_either(p, end, '\n', '\n');
+    if(p >= end) return end;
+    char *prev = p - 1;
+    if(*prev == '\r') prev--;
+    if(*prev != '\\') return p;
+    p++;
+  }
+}
+
+static SLEX_CONSTEXPR slex_bool slex_is_blank(char c) {
+  return c == ' ' || c == '\t' || c == '\v' || c == '\f' || c == '\r';
+}
+
+static SLEX_CONSTEXPR slex_bool slex_directive_is(const SlexDirective *d, const char *name) {
+  size_t i = 0;
+  for(; name[i]; i++) {
+    if(i >= d->name_len || d->name[i] != name[i]) return 0;
+  }
+  return i == d->name_len;
+}
+
+// Whether only blanks and comments are between the start of its line and p; after a line
+// splice the previous line goes on. The blanks are walked back, the comments were seen by
+// the scan on its way (comment_end).
+static SLEX_CONSTEXPR slex_bool slex_at_line_start(const SlexDirectiveScanner *sc, char *p) {
+  while(p > sc->stream_begin && slex_is_blank(p[-1])) p--;
+  if(p == sc->stream_begin || p == sc->comment_end) return 1;
+  if(p[-1] != '\n') return 0;
+  p--;
+  if(p > sc->stream_begin && p[-1] == '\r') p--;
+  return p == sc->stream_begin || p[-1] != '\\';
+}
+
+// Fills the rest of directive once its name is known and returns where scanning goes on.
+// The include path is taken verbatim.
+static SLEX_CONSTEXPR char *slex_finish_directive(SlexDirectiveScanner *sc, char *line_end, SlexDirective *d) {
+  char *args = d->name + d->name_len;
+  char *args_end = line_end;
+  while(args < args_end && slex_is_blank(*args)) args++;
+  while(args_end > args && slex_is_blank(args_end[-1])) args_end--;
+  char *resume = d->name + d->name_len;
+
+  d->include_kind = 0;
+  if(slex_directive_is(d, "include") && args < args_end && (*args == '<' || *args == '"')) {
+    char close = *args == '<' ? '>' : '"';
+    char *path_end = slex_find_either(args + 1, args_end, close, close);
+    if(path_end < args_end) {
+      d->include_kind = *args;
+      args_end = path_end;
+      args++;
+      // a // or /* inside the path doesn't start a comment
+      resume = path_end + 1;
     }
   }
+  d->args = args;
+  d->args_len = (size_t)(args_end - args);
+
+  if(slex_directive_is(d, "if") || slex_directive_is(d, "ifdef") || slex_directive_is(d, "ifndef")) {
+    d->depth = sc->depth++;
+  } else if(slex_directive_is(d, "elif") || slex_directive_is(d, "else")
+      || slex_directive_is(d, "elifdef") || slex_directive_is(d, "elifndef")) {
+    d->depth = sc->depth ? sc->depth - 1 : 0;
+  } else if(slex_directive_is(d, "endif")) {
+    if(sc->depth) sc->depth--;
+    d->depth = sc->depth;
+  } else {
+    d->depth = sc->depth;
+  }
+  return resume;
+}
 
-  ctx->tok_ty = match_ty;
-  ctx->first_tok_char = ctx->parse_point;
-  ctx->last_tok_char = ctx->parse_point + tok_len - 1;
-  ctx->parse_point += tok_len;
-  return 1;
+
+// Whether the whitespace and comments between two tokens, [p, end), end the line: they
+// have a \n outside of block comments. A line comment always ends at one.
+static SLEX_CONSTEXPR slex_bool slex_gap_breaks_line(const char *p, const char *end) {
+  while(p < end) {
+    if(*p == '\n') return 1;
+    if(*p == '/') {
+      if(end - p < 2 || p[1] != '*') return 1;
+      for(p += 2; end - p >= 2 && !(p[0] == '*' && p[1] == '/'); p++) {}
+      if(end - p < 2) return 0;
+      p += 2;
+      continue;
+    }
+    p++;
+  }
+  return 0;
 }
 
-static slex_bool slex_mul_overflows_u64(slex_u64 a, slex_u64 b) {
-  return a != 0 && b != 0 && a > 0xFFFFFFFFFFFFFFFF / b;
+// Character classes of the minifier: 0 other, 1 letters and _, 2 e E p P (exponents),
+// 3 digits, 4 quotes, 5 \, 6 ., 7 + -, 8 the other characters of punctuators and comments.
+// Bytes from 0x80 on are letters.
+static SLEX_CONSTEXPR const unsigned char slex_minify_classes[128] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 8, 4, 8, 0, 8, 8, 4, 0, 0, 8, 7, 0, 7, 6, 8,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 0, 8, 8, 8, 0,
+  0, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 5, 0, 8, 1,
+  0, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 8, 0, 0, 0,
+};
+
+// Whether a token ending with a character of one class has to be separated from a token
+// starting with another, indexed by [first token is a number][class][class]. 1 where C
+// would run them together: words, numbers with their pp-number spelling (1.L, 0x1e+1),
+// literal prefixes and suffixes (L "s", "s" _x) and universal character names (\ u00e9).
+// 2 where they might form another punctuator or a comment, which the lexer decides. 0 otherwise.
+static SLEX_CONSTEXPR const unsigned char slex_minify_pairs[2][9][9] = {
+  {
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 1, 1, 1, 0, 0, 0, 0},
+    {0, 1, 1, 1, 1, 0, 0, 0, 0},
+    {0, 1, 1, 1, 1, 0, 0, 0, 0},
+    {0, 1, 1, 1, 0, 0, 0, 0, 0},
+    {0, 1, 1, 1, 0, 0, 0, 0, 0},
+    {0, 0, 0, 1, 0, 0, 2, 2, 2},
+    {0, 0, 0, 0, 0, 0, 2, 2, 2},
+    {0, 0, 0, 0, 0, 0, 2, 2, 2},
+  },
+  {
+    {0, 1, 1, 1, 1, 0, 1, 0, 0},
+    {0, 1, 1, 1, 1, 0, 1, 0, 0},
+    {0, 1, 1, 1, 1, 0, 1, 1, 0},
+    {0, 1, 1, 1, 1, 0, 1, 0, 0},
+    {0, 1, 1, 1, 1, 0, 1, 0, 0},
+    {0, 1, 1, 1, 1, 0, 1, 0, 0},
+    {0, 1, 1, 1, 1, 0, 1, 2, 2},
+    {0, 1, 1, 1, 1, 0, 1, 2, 2},
+    {0, 1, 1, 1, 1, 0, 1, 2, 2},
+  },
+};
+
+static SLEX_CONSTEXPR inline int slex_minify_class(char c) {
+  return (unsigned char)c >= 0x80 ? 1 : slex_minify_classes[(unsigned char)c];
 }
 
-static slex_bool slex_add_overflows_u64(slex_u64 a, slex_u64 b) {
-  return a > 0xFFFFFFFFFFFFFFFF - b;
+static SLEX_CONSTEXPR inline int slex_minify_space(char a, char b, slex_bool a_is_number) {
+  return slex_minify_pairs[a_is_number][slex_minify_class(a)][slex_minify_class(b)];
 }
 
-static int slex_utf8_encode_esc_seq(SlexContext *ctx, slex_i32 codepoint, char *loc) {
+static SLEX_CONSTEXPR int slex_utf8_encode_esc_seq(SlexContext *ctx, slex_i64 codepoint, char *loc) {
   if (codepoint > 0x10FFFF || loc >= ctx->string_store + ctx->string_store_len)
     return slex_return_err(SLEX_ERR_storage, ctx) -1;
 
@@ -308,48 +910,674 @@ static int slex_utf8_encode_esc_seq(SlexContext *ctx, slex_i32 codepoint, char *
   }
 }
 
-static slex_bool slex_parse_punctuator(SlexContext *ctx) {
-  switch (*ctx->parse_point) {
-    case '[':
-      return slex_consume_single_char(ctx, SLEX_TOK_l_square_paren);
-    case ']':
-      return slex_consume_single_char(ctx, SLEX_TOK_r_square_paren);
-    case '(':
-      return slex_consume_single_char(ctx, SLEX_TOK_l_paren);
-    case ')':
-      return slex_consume_single_char(ctx, SLEX_TOK_r_paren);
-    case '{':
-      return slex_consume_single_char(ctx, SLEX_TOK_l_brace);
-    case '}':
-      return slex_consume_single_char(ctx, SLEX_TOK_r_brace);
-    case '.':
-      if (slex_try_match(ctx, SLEX_TOK_unpack, "...", 3)) return 1;
-#if SLEX_CXX_SUPPORT
-      if (slex_try_match(ctx, SLEX_TOK_member_access, ".*", 2)) return 1;
-#endif
-      return slex_consume_single_char(ctx, SLEX_TOK_period);
-    case '&':
-      if (slex_try_match(ctx, SLEX_TOK_and, "&&", 2)) return 1;
-      if (slex_try_match(ctx, SLEX_TOK_bitwise_and_eq, "&=", 2)) return 1;
-      return slex_consume_single_char(ctx, SLEX_TOK_bitwise_and);
-    case '*':
-      if (slex_try_match(ctx, SLEX_TOK_mul_eq, "*=", 2)) return 1;
-      return slex_consume_single_char(ctx, SLEX_TOK_mul);
-    case '+':
-      if (slex_try_match(ctx, SLEX_TOK_inc, "++", 2)) return 1;
-      if (slex_try_match(ctx, SLEX_TOK_plus_eq, "+=", 2)) return 1;
-      return slex_consume_single_char(ctx, SLEX_TOK_plus);
-    case '-':
-      if (slex_try_match(ctx, SLEX_TOK_arrow, "->", 2)) return 1;
-      if (slex_try_match(ctx, SLEX_TOK_dec, "--", 2)) return 1;
-      if (slex_try_match(ctx, SLEX_TOK_minus_eq, "-=", 2)) return 1;
-#if SLEX_CXX_SUPPORT
-      if (slex_try_match(ctx, SLEX_TOK_deref_access, "->*", 3)) return 1;
-#endif
-      return slex_consume_single_char(ctx, SLEX_TOK_minus);
-    case '~':
-      return slex_consume_single_char(ctx, SLEX_TOK_bitwise_not);
-    case '!':
+static SLEX_CONSTEXPR double slex_pow(double base, int exponent) {
+  if (exponent == 0) return 1.0;
+
+  int is_negative = exponent < 0;
+  if (is_negative) exponent = -exponent;
+
+  double result = 1.0;
+  while (exponent > 0) {
+    if (exponent % 2 == 1) {
+      if(slex_mul_overflows_u64(result, base))
+        return -1;
+      result *= base;
+    }
+    if(slex_mul_overflows_u64(base, base))
+      return -1;
+    base *= base;
+    exponent /= 2;
+  }
+
+  return is_negative ? 1.0 / result : result;
+}
+
+static SLEX_CONSTEXPR slex_i64 slex_parse_esc_seq(SlexContext *ctx) {
+  ctx->parse_point++; // consume the backslash
+
+  if(ctx->parse_point >= ctx->stream_end) 
+    return slex_return_err(SLEX_ERR_parse, ctx) -1;
+
+  if(slex_is_oct(*ctx->parse_point)) {
+    int oct = 0;
+    int i = 0;
+    while(ctx->parse_point < ctx->stream_end && i < 3) {
+      if(!slex_is_oct(*ctx->parse_point)) break;
+      oct = oct * 8 + *ctx->parse_point - '0';
+      ctx->parse_point++;
+      i++;
+    }
+    return oct;
+  }
+
+  if(*ctx->parse_point == 'x') {
+    if(ctx->parse_point > ctx->stream_end - 3 || !slex_is_hex(ctx->parse_point[1])) {
+      ctx->parse_point++;
+      return slex_return_err(SLEX_ERR_parse, ctx) -1;
+    }
+
+    if(!slex_is_hex(ctx->parse_point[2])) {
+      ctx->parse_point += 2;
+      return slex_return_err(SLEX_ERR_parse, ctx) -1;
+    }
+
+    int hex = slex_hex_to_int(ctx->parse_point[1]) * 16 + slex_hex_to_int(ctx->parse_point[2]); 
+    ctx->parse_point += 3;
+    return hex;
+  }
+
+  if(*ctx->parse_point == 'u' || *ctx->parse_point == 'U') {
+    slex_i64 codepoint = 0;
+    int i = 0;
+    int len = *ctx->parse_point == 'u' ? 4 : 8;
+    ctx->parse_point++;
+
+    while(ctx->parse_point < ctx->stream_end && i < len) {
+      if(!slex_is_hex(*ctx->parse_point)) break;
+      codepoint = codepoint * 16 + slex_hex_to_int(*ctx->parse_point);
+      ctx->parse_point++;
+      i++;
+    }
+
+    if(i != len) 
+      return slex_return_err(SLEX_ERR_parse, ctx) -1;
+
+    return codepoint;
+  }
+
+  ctx->parse_point++;
+  switch(ctx->parse_point[-1]) {
+    default: ctx->parse_point--; return slex_return_err(SLEX_ERR_parse, ctx) -1;
+    case 'a': return '\a';
+    case 'b': return '\b';
+    case 'f': return '\f';
+    case 'n': return '\n';
+    case 'r': return '\r';
+    case 't': return '\t';
+    case 'v': return '\v';
+    case '\\': return '\\';
+    case '\'': return '\'';
+    case '"': return '"';
+    case '?': return '\?';
+  }
+}
+
+// Lexes the literal starting at ctx->first_tok_char on from ctx->parse_point, with
+// ctx->str_len characters of it stored. Returns 2 if it reached limit before the end of
+// the stream, with ctx->str_len updated.
+static SLEX_CONSTEXPR int slex_continue_char_or_str_lit(SlexContext *ctx, char *limit) {
+  size_t curr_str_idx = ctx->str_len;
+  char delim = *ctx->first_tok_char;
+
+  while(ctx->parse_point < limit) {
+    if(*ctx->parse_point == delim) {
+      ctx->last_tok_char = ctx->parse_point;
+      ctx->str_len = curr_str_idx;
+      ctx->parse_point++;
+      return 1;
+    }
+
+    if(curr_str_idx >= ctx->string_store_len) 
+      return slex_return_err(SLEX_ERR_storage, ctx);
+
+    if(*ctx->parse_point == '\\') {
+      slex_i64 c = slex_parse_esc_seq(ctx);
+      if(c == -1) return 0;
+
+      int len = slex_utf8_encode_esc_seq(ctx, c, ctx->string_store + curr_str_idx);
+      if(len == -1)
+        return slex_return_err(SLEX_ERR_storage, ctx);
+
+      curr_str_idx += len;
+    }
+    else {
+      ctx->string_store[curr_str_idx] = *ctx->parse_point;
+      ctx->parse_point++;
+      curr_str_idx++;
+    }
+  }
+
+  if(limit < ctx->stream_end) {
+    ctx->str_len = curr_str_idx;
+    return 2;
+  }
+  return slex_return_err(SLEX_ERR_parse, ctx);
+}
+
+static SLEX_CONSTEXPR slex_bool slex_parse_char_or_str_lit(SlexContext *ctx) {
+  char delim = *ctx->parse_point;
+  ctx->tok_ty = delim == '"' ? SLEX_TOK_str_lit : SLEX_TOK_char_lit;
+  ctx->first_tok_char = ctx->parse_point;
+  ctx->str_len = 0;
+
+  ctx->parse_point++; // consume " or '
+  return slex_continue_char_or_str_lit(ctx, ctx->stream_end);
+}
+
+// Picks the smallest hash (the rightmost on ties) of the last count k-grams and emits it
+// unless it was the last one emitted.
+static SLEX_CONSTEXPR void slex_fingerprint_pick(SlexFingerprinter *fp, size_t count, SlexFingerprint *out, size_t *out_len) {
+  size_t pick = fp->gram_count - count;
+  for(size_t i = pick + 1; i < fp->gram_count; i++) {
+    if(fp->gram_hashes[i % fp->window] <= fp->gram_hashes[pick % fp->window])
+      pick = i;
+  }
+  if(pick == fp->last_pick) return;
+  fp->last_pick = pick;
+  out[*out_len].hash = fp->gram_hashes[pick % fp->window];
+  out[*out_len].offset = fp->gram_offsets[pick % fp->window];
+  (*out_len)++;
+}
+
+// Identifier characters above U+007F for C23 and C++: XID_Start and XID_Continue of Unicode
+// 14 as sorted ranges, start set if the range can also start an identifier (every XID_Start
+// character is XID_Continue). Generated with Python 3.11, whose str.isidentifier uses the
+// same properties, by merging adjacent code points of the same kind:
+//
+//   start = chr(cp).isidentifier()
+//   cont = ("a" + chr(cp)).isidentifier()
+typedef struct {
+  slex_u32 first;
+  slex_u32 last;
+  slex_u32 start;
+} SlexXidRange;
+
+static SLEX_CONSTEXPR const SlexXidRange slex_xid_ranges[] = {
+  {0xAA, 0xAA, 1}, {0xB5, 0xB5, 1}, {0xB7, 0xB7, 0}, {0xBA, 0xBA, 1}, {0xC0, 0xD6, 1},
+  {0xD8, 0xF6, 1}, {0xF8, 0x2C1, 1}, {0x2C6, 0x2D1, 1}, {0x2E0, 0x2E4, 1}, {0x2EC, 0x2EC, 1},
+  {0x2EE, 0x2EE, 1}, {0x300, 0x36F, 0}, {0x370, 0x374, 1}, {0x376, 0x377, 1}, {0x37B, 0x37D, 1},
+  {0x37F, 0x37F, 1}, {0x386, 0x386, 1}, {0x387, 0x387, 0}, {0x388, 0x38A, 1}, {0x38C, 0x38C, 1},
+  {0x38E, 0x3A1, 1}, {0x3A3, 0x3F5, 1}, {0x3F7, 0x481, 1}, {0x483, 0x487, 0}, {0x48A, 0x52F, 1},
+  {0x531, 0x556, 1}, {0x559, 0x559, 1}, {0x560, 0x588, 1}, {0x591, 0x5BD, 0}, {0x5BF, 0x5BF, 0},
+  {0x5C1, 0x5C2, 0}, {0x5C4, 0x5C5, 0}, {0x5C7, 0x5C7, 0}, {0x5D0, 0x5EA, 1}, {0x5EF, 0x5F2, 1},
+  {0x610, 0x61A, 0}, {0x620, 0x64A, 1}, {0x64B, 0x669, 0}, {0x66E, 0x66F, 1}, {0x670, 0x670, 0},
+  {0x671, 0x6D3, 1}, {0x6D5, 0x6D5, 1}, {0x6D6, 0x6DC, 0}, {0x6DF, 0x6E4, 0}, {0x6E5, 0x6E6, 1},
+  {0x6E7, 0x6E8, 0}, {0x6EA, 0x6ED, 0}, {0x6EE, 0x6EF, 1}, {0x6F0, 0x6F9, 0}, {0x6FA, 0x6FC, 1},
+  {0x6FF, 0x6FF, 1}, {0x710, 0x710, 1}, {0x711, 0x711, 0}, {0x712, 0x72F, 1}, {0x730, 0x74A, 0},
+  {0x74D, 0x7A5, 1}, {0x7A6, 0x7B0, 0}, {0x7B1, 0x7B1, 1}, {0x7C0, 0x7C9, 0}, {0x7CA, 0x7EA, 1},
+  {0x7EB, 0x7F3, 0}, {0x7F4, 0x7F5, 1}, {0x7FA, 0x7FA, 1}, {0x7FD, 0x7FD, 0}, {0x800, 0x815, 1},
+  {0x816, 0x819, 0}, {0x81A, 0x81A, 1}, {0x81B, 0x823, 0}, {0x824, 0x824, 1}, {0x825, 0x827, 0},
+  {0x828, 0x828, 1}, {0x829, 0x82D, 0}, {0x840, 0x858, 1}, {0x859, 0x85B, 0}, {0x860, 0x86A, 1},
+  {0x870, 0x887, 1}, {0x889, 0x88E, 1}, {0x898, 0x89F, 0}, {0x8A0, 0x8C9, 1}, {0x8CA, 0x8E1, 0},
+  {0x8E3, 0x903, 0}, {0x904, 0x939, 1}, {0x93A, 0x93C, 0}, {0x93D, 0x93D, 1}, {0x93E, 0x94F, 0},
+  {0x950, 0x950, 1}, {0x951, 0x957, 0}, {0x958, 0x961, 1}, {0x962, 0x963, 0}, {0x966, 0x96F, 0},
+  {0x971, 0x980, 1}, {0x981, 0x983, 0}, {0x985, 0x98C, 1}, {0x98F, 0x990, 1}, {0x993, 0x9A8, 1},
+  {0x9AA, 0x9B0, 1}, {0x9B2, 0x9B2, 1}, {0x9B6, 0x9B9, 1}, {0x9BC, 0x9BC, 0}, {0x9BD, 0x9BD, 1},
+  {0x9BE, 0x9C4, 0}, {0x9C7, 0x9C8, 0}, {0x9CB, 0x9CD, 0}, {0x9CE, 0x9CE, 1}, {0x9D7, 0x9D7, 0},
+  {0x9DC, 0x9DD, 1}, {0x9DF, 0x9E1, 1}, {0x9E2, 0x9E3, 0}, {0x9E6, 0x9EF, 0}, {0x9F0, 0x9F1, 1},
+  {0x9FC, 0x9FC, 1}, {0x9FE, 0x9FE, 0}, {0xA01, 0xA03, 0}, {0xA05, 0xA0A, 1}, {0xA0F, 0xA10, 1},
+  {0xA13, 0xA28, 1}, {0xA2A, 0xA30, 1}, {0xA32, 0xA33, 1}, {0xA35, 0xA36, 1}, {0xA38, 0xA39, 1},
+  {0xA3C, 0xA3C, 0}, {0xA3E, 0xA42, 0}, {0xA47, 0xA48, 0}, {0xA4B, 0xA4D, 0}, {0xA51, 0xA51, 0},
+  {0xA59, 0xA5C, 1}, {0xA5E, 0xA5E, 1}, {0xA66, 0xA71, 0}, {0xA72, 0xA74, 1}, {0xA75, 0xA75, 0},
+  {0xA81, 0xA83, 0}, {0xA85, 0xA8D, 1}, {0xA8F, 0xA91, 1}, {0xA93, 0xAA8, 1}, {0xAAA, 0xAB0, 1},
+  {0xAB2, 0xAB3, 1}, {0xAB5, 0xAB9, 1}, {0xABC, 0xABC, 0}, {0xABD, 0xABD, 1}, {0xABE, 0xAC5, 0},
+  {0xAC7, 0xAC9, 0}, {0xACB, 0xACD, 0}, {0xAD0, 0xAD0, 1}, {0xAE0, 0xAE1, 1}, {0xAE2, 0xAE3, 0},
+  {0xAE6, 0xAEF, 0}, {0xAF9, 0xAF9, 1}, {0xAFA, 0xAFF, 0}, {0xB01, 0xB03, 0}, {0xB05, 0xB0C, 1},
+  {0xB0F, 0xB10, 1}, {0xB13, 0xB28, 1}, {0xB2A, 0xB30, 1}, {0xB32, 0xB33, 1}, {0xB35, 0xB39, 1},
+  {0xB3C, 0xB3C, 0}, {0xB3D, 0xB3D, 1}, {0xB3E, 0xB44, 0}, {0xB47, 0xB48, 0}, {0xB4B, 0xB4D, 0},
+  {0xB55, 0xB57, 0}, {0xB5C, 0xB5D, 1}, {0xB5F, 0xB61, 1}, {0xB62, 0xB63, 0}, {0xB66, 0xB6F, 0},
+  {0xB71, 0xB71, 1}, {0xB82, 0xB82, 0}, {0xB83, 0xB83, 1}, {0xB85, 0xB8A, 1}, {0xB8E, 0xB90, 1},
+  {0xB92, 0xB95, 1}, {0xB99, 0xB9A, 1}, {0xB9C, 0xB9C, 1}, {0xB9E, 0xB9F, 1}, {0xBA3, 0xBA4, 1},
+  {0xBA8, 0xBAA, 1}, {0xBAE, 0xBB9, 1}, {0xBBE, 0xBC2, 0}, {0xBC6, 0xBC8, 0}, {0xBCA, 0xBCD, 0},
+  {0xBD0, 0xBD0, 1}, {0xBD7, 0xBD7, 0}, {0xBE6, 0xBEF, 0}, {0xC00, 0xC04, 0}, {0xC05, 0xC0C, 1},
+  {0xC0E, 0xC10, 1}, {0xC12, 0xC28, 1}, {0xC2A, 0xC39, 1}, {0xC3C, 0xC3C, 0}, {0xC3D, 0xC3D, 1},
+  {0xC3E, 0xC44, 0}, {0xC46, 0xC48, 0}, {0xC4A, 0xC4D, 0}, {0xC55, 0xC56, 0}, {0xC58, 0xC5A, 1},
+  {0xC5D, 0xC5D, 1}, {0xC60, 0xC61, 1}, {0xC62, 0xC63, 0}, {0xC66, 0xC6F, 0}, {0xC80, 0xC80, 1},
+  {0xC81, 0xC83, 0}, {0xC85, 0xC8C, 1}, {0xC8E, 0xC90, 1}, {0xC92, 0xCA8, 1}, {0xCAA, 0xCB3, 1},
+  {0xCB5, 0xCB9, 1}, {0xCBC, 0xCBC, 0}, {0xCBD, 0xCBD, 1}, {0xCBE, 0xCC4, 0}, {0xCC6, 0xCC8, 0},
+  {0xCCA, 0xCCD, 0}, {0xCD5, 0xCD6, 0}, {0xCDD, 0xCDE, 1}, {0xCE0, 0xCE1, 1}, {0xCE2, 0xCE3, 0},
+  {0xCE6, 0xCEF, 0}, {0xCF1, 0xCF2, 1}, {0xD00, 0xD03, 0}, {0xD04, 0xD0C, 1}, {0xD0E, 0xD10, 1},
+  {0xD12, 0xD3A, 1}, {0xD3B, 0xD3C, 0}, {0xD3D, 0xD3D, 1}, {0xD3E, 0xD44, 0}, {0xD46, 0xD48, 0},
+  {0xD4A, 0xD4D, 0}, {0xD4E, 0xD4E, 1}, {0xD54, 0xD56, 1}, {0xD57, 0xD57, 0}, {0xD5F, 0xD61, 1},
+  {0xD62, 0xD63, 0}, {0xD66, 0xD6F, 0}, {0xD7A, 0xD7F, 1}, {0xD81, 0xD83, 0}, {0xD85, 0xD96, 1},
+  {0xD9A, 0xDB1, 1}, {0xDB3, 0xDBB, 1}, {0xDBD, 0xDBD, 1}, {0xDC0, 0xDC6, 1}, {0xDCA, 0xDCA, 0},
+  {0xDCF, 0xDD4, 0}, {0xDD6, 0xDD6, 0}, {0xDD8, 0xDDF, 0}, {0xDE6, 0xDEF, 0}, {0xDF2, 0xDF3, 0},
+  {0xE01, 0xE30, 1}, {0xE31, 0xE31, 0}, {0xE32, 0xE32, 1}, {0xE33, 0xE3A, 0}, {0xE40, 0xE46, 1},
+  {0xE47, 0xE4E, 0}, {0xE50, 0xE59, 0}, {0xE81, 0xE82, 1}, {0xE84, 0xE84, 1}, {0xE86, 0xE8A, 1},
+  {0xE8C, 0xEA3, 1}, {0xEA5, 0xEA5, 1}, {0xEA7, 0xEB0, 1}, {0xEB1, 0xEB1, 0}, {0xEB2, 0xEB2, 1},
+  {0xEB3, 0xEBC, 0}, {0xEBD, 0xEBD, 1}, {0xEC0, 0xEC4, 1}, {0xEC6, 0xEC6, 1}, {0xEC8, 0xECD, 0},
+  {0xED0, 0xED9, 0}, {0xEDC, 0xEDF, 1}, {0xF00, 0xF00, 1}, {0xF18, 0xF19, 0}, {0xF20, 0xF29, 0},
+  {0xF35, 0xF35, 0}, {0xF37, 0xF37, 0}, {0xF39, 0xF39, 0}, {0xF3E, 0xF3F, 0}, {0xF40, 0xF47, 1},
+  {0xF49, 0xF6C, 1}, {0xF71, 0xF84, 0}, {0xF86, 0xF87, 0}, {0xF88, 0xF8C, 1}, {0xF8D, 0xF97, 0},
+  {0xF99, 0xFBC, 0}, {0xFC6, 0xFC6, 0}, {0x1000, 0x102A, 1}, {0x102B, 0x103E, 0},
+  {0x103F, 0x103F, 1}, {0x1040, 0x1049, 0}, {0x1050, 0x1055, 1}, {0x1056, 0x1059, 0},
+  {0x105A, 0x105D, 1}, {0x105E, 0x1060, 0}, {0x1061, 0x1061, 1}, {0x1062, 0x1064, 0},
+  {0x1065, 0x1066, 1}, {0x1067, 0x106D, 0}, {0x106E, 0x1070, 1}, {0x1071, 0x1074, 0},
+  {0x1075, 0x1081, 1}, {0x1082, 0x108D, 0}, {0x108E, 0x108E, 1}, {0x108F, 0x109D, 0},
+  {0x10A0, 0x10C5, 1}, {0x10C7, 0x10C7, 1}, {0x10CD, 0x10CD, 1}, {0x10D0, 0x10FA, 1},
+  {0x10FC, 0x1248, 1}, {0x124A, 0x124D, 1}, {0x1250, 0x1256, 1}, {0x1258, 0x1258, 1},
+  {0x125A, 0x125D, 1}, {0x1260, 0x1288, 1}, {0x128A, 0x128D, 1}, {0x1290, 0x12B0, 1},
+  {0x12B2, 0x12B5, 1}, {0x12B8, 0x12BE, 1}, {0x12C0, 0x12C0, 1}, {0x12C2, 0x12C5, 1},
+  {0x12C8, 0x12D6, 1}, {0x12D8, 0x1310, 1}, {0x1312, 0x1315, 1}, {0x1318, 0x135A, 1},
+  {0x135D, 0x135F, 0}, {0x1369, 0x1371, 0}, {0x1380, 0x138F, 1}, {0x13A0, 0x13F5, 1},
+  {0x13F8, 0x13FD, 1}, {0x1401, 0x166C, 1}, {0x166F, 0x167F, 1}, {0x1681, 0x169A, 1},
+  {0x16A0, 0x16EA, 1}, {0x16EE, 0x16F8, 1}, {0x1700, 0x1711, 1}, {0x1712, 0x1715, 0},
+  {0x171F, 0x1731, 1}, {0x1732, 0x1734, 0}, {0x1740, 0x1751, 1}, {0x1752, 0x1753, 0},
+  {0x1760, 0x176C, 1}, {0x176E, 0x1770, 1}, {0x1772, 0x1773, 0}, {0x1780, 0x17B3, 1},
+  {0x17B4, 0x17D3, 0}, {0x17D7, 0x17D7, 1}, {0x17DC, 0x17DC, 1}, {0x17DD, 0x17DD, 0},
+  {0x17E0, 0x17E9, 0}, {0x180B, 0x180D, 0}, {0x180F, 0x1819, 0}, {0x1820, 0x1878, 1},
+  {0x1880, 0x18A8, 1}, {0x18A9, 0x18A9, 0}, {0x18AA, 0x18AA, 1}, {0x18B0, 0x18F5, 1},
+  {0x1900, 0x191E, 1}, {0x1920, 0x192B, 0}, {0x1930, 0x193B, 0}, {0x1946, 0x194F, 0},
+  {0x1950, 0x196D, 1}, {0x1970, 0x1974, 1}, {0x1980, 0x19AB, 1}, {0x19B0, 0x19C9, 1},
+  {0x19D0, 0x19DA, 0}, {0x1A00, 0x1A16, 1}, {0x1A17, 0x1A1B, 0}, {0x1A20, 0x1A54, 1},
+  {0x1A55, 0x1A5E, 0}, {0x1A60, 0x1A7C, 0}, {0x1A7F, 0x1A89, 0}, {0x1A90, 0x1A99, 0},
+  {0x1AA7, 0x1AA7, 1}, {0x1AB0, 0x1ABD, 0}, {0x1ABF, 0x1ACE, 0}, {0x1B00, 0x1B04, 0},
+  {0x1B05, 0x1B33, 1}, {0x1B34, 0x1B44, 0}, {0x1B45, 0x1B4C, 1}, {0x1B50, 0x1B59, 0},
+  {0x1B6B, 0x1B73, 0}, {0x1B80, 0x1B82, 0}, {0x1B83, 0x1BA0, 1}, {0x1BA1, 0x1BAD, 0},
+  {0x1BAE, 0x1BAF, 1}, {0x1BB0, 0x1BB9, 0}, {0x1BBA, 0x1BE5, 1}, {0x1BE6, 0x1BF3, 0},
+  {0x1C00, 0x1C23, 1}, {0x1C24, 0x1C37, 0}, {0x1C40, 0x1C49, 0}, {0x1C4D, 0x1C4F, 1},
+  {0x1C50, 0x1C59, 0}, {0x1C5A, 0x1C7D, 1}, {0x1C80, 0x1C88, 1}, {0x1C90, 0x1CBA, 1},
+  {0x1CBD, 0x1CBF, 1}, {0x1CD0, 0x1CD2, 0}, {0x1CD4, 0x1CE8, 0}, {0x1CE9, 0x1CEC, 1},
+  {0x1CED, 0x1CED, 0}, {0x1CEE, 0x1CF3, 1}, {0x1CF4, 0x1CF4, 0}, {0x1CF5, 0x1CF6, 1},
+  {0x1CF7, 0x1CF9, 0}, {0x1CFA, 0x1CFA, 1}, {0x1D00, 0x1DBF, 1}, {0x1DC0, 0x1DFF, 0},
+  {0x1E00, 0x1F15, 1}, {0x1F18, 0x1F1D, 1}, {0x1F20, 0x1F45, 1}, {0x1F48, 0x1F4D, 1},
+  {0x1F50, 0x1F57, 1}, {0x1F59, 0x1F59, 1}, {0x1F5B, 0x1F5B, 1}, {0x1F5D, 0x1F5D, 1},
+  {0x1F5F, 0x1F7D, 1}, {0x1F80, 0x1FB4, 1}, {0x1FB6, 0x1FBC, 1}, {0x1FBE, 0x1FBE, 1},
+  {0x1FC2, 0x1FC4, 1}, {0x1FC6, 0x1FCC, 1}, {0x1FD0, 0x1FD3, 1}, {0x1FD6, 0x1FDB, 1},
+  {0x1FE0, 0x1FEC, 1}, {0x1FF2, 0x1FF4, 1}, {0x1FF6, 0x1FFC, 1}, {0x203F, 0x2040, 0},
+  {0x2054, 0x2054, 0}, {0x2071, 0x2071, 1}, {0x207F, 0x207F, 1}, {0x2090, 0x209C, 1},
+  {0x20D0, 0x20DC, 0}, {0x20E1, 0x20E1, 0}, {0x20E5, 0x20F0, 0}, {0x2102, 0x2102, 1},
+  {0x2107, 0x2107, 1}, {0x210A, 0x2113, 1}, {0x2115, 0x2115, 1}, {0x2118, 0x211D, 1},
+  {0x2124, 0x2124, 1}, {0x2126, 0x2126, 1}, {0x2128, 0x2128, 1}, {0x212A, 0x2139, 1},
+  {0x213C, 0x213F, 1}, {0x2145, 0x2149, 1}, {0x214E, 0x214E, 1}, {0x2160, 0x2188, 1},
+  {0x2C00, 0x2CE4, 1}, {0x2CEB, 0x2CEE, 1}, {0x2CEF, 0x2CF1, 0}, {0x2CF2, 0x2CF3, 1},
+  {0x2D00, 0x2D25, 1}, {0x2D27, 0x2D27, 1}, {0x2D2D, 0x2D2D, 1}, {0x2D30, 0x2D67, 1},
+  {0x2D6F, 0x2D6F, 1}, {0x2D7F, 0x2D7F, 0}, {0x2D80, 0x2D96, 1}, {0x2DA0, 0x2DA6, 1},
+  {0x2DA8, 0x2DAE, 1}, {0x2DB0, 0x2DB6, 1}, {0x2DB8, 0x2DBE, 1}, {0x2DC0, 0x2DC6, 1},
+  {0x2DC8, 0x2DCE, 1}, {0x2DD0, 0x2DD6, 1}, {0x2DD8, 0x2DDE, 1}, {0x2DE0, 0x2DFF, 0},
+  {0x3005, 0x3007, 1}, {0x3021, 0x3029, 1}, {0x302A, 0x302F, 0}, {0x3031, 0x3035, 1},
+  {0x3038, 0x303C, 1}, {0x3041, 0x3096, 1}, {0x3099, 0x309A, 0}, {0x309D, 0x309F, 1},
+  {0x30A1, 0x30FA, 1}, {0x30FC, 0x30FF, 1}, {0x3105, 0x312F, 1}, {0x3131, 0x318E, 1},
+  {0x31A0, 0x31BF, 1}, {0x31F0, 0x31FF, 1}, {0x3400, 0x4DBF, 1}, {0x4E00, 0xA48C, 1},
+  {0xA4D0, 0xA4FD, 1}, {0xA500, 0xA60C, 1}, {0xA610, 0xA61F, 1}, {0xA620, 0xA629, 0},
+  {0xA62A, 0xA62B, 1}, {0xA640, 0xA66E, 1}, {0xA66F, 0xA66F, 0}, {0xA674, 0xA67D, 0},
+  {0xA67F, 0xA69D, 1}, {0xA69E, 0xA69F, 0}, {0xA6A0, 0xA6EF, 1}, {0xA6F0, 0xA6F1, 0},
+  {0xA717, 0xA71F, 1}, {0xA722, 0xA788, 1}, {0xA78B, 0xA7CA, 1}, {0xA7D0, 0xA7D1, 1},
+  {0xA7D3, 0xA7D3, 1}, {0xA7D5, 0xA7D9, 1}, {0xA7F2, 0xA801, 1}, {0xA802, 0xA802, 0},
+  {0xA803, 0xA805, 1}, {0xA806, 0xA806, 0}, {0xA807, 0xA80A, 1}, {0xA80B, 0xA80B, 0},
+  {0xA80C, 0xA822, 1}, {0xA823, 0xA827, 0}, {0xA82C, 0xA82C, 0}, {0xA840, 0xA873, 1},
+  {0xA880, 0xA881, 0}, {0xA882, 0xA8B3, 1}, {0xA8B4, 0xA8C5, 0}, {0xA8D0, 0xA8D9, 0},
+  {0xA8E0, 0xA8F1, 0}, {0xA8F2, 0xA8F7, 1}, {0xA8FB, 0xA8FB, 1}, {0xA8FD, 0xA8FE, 1},
+  {0xA8FF, 0xA909, 0}, {0xA90A, 0xA925, 1}, {0xA926, 0xA92D, 0}, {0xA930, 0xA946, 1},
+  {0xA947, 0xA953, 0}, {0xA960, 0xA97C, 1}, {0xA980, 0xA983, 0}, {0xA984, 0xA9B2, 1},
+  {0xA9B3, 0xA9C0, 0}, {0xA9CF, 0xA9CF, 1}, {0xA9D0, 0xA9D9, 0}, {0xA9E0, 0xA9E4, 1},
+  {0xA9E5, 0xA9E5, 0}, {0xA9E6, 0xA9EF, 1}, {0xA9F0, 0xA9F9, 0}, {0xA9FA, 0xA9FE, 1},
+  {0xAA00, 0xAA28, 1}, {0xAA29, 0xAA36, 0}, {0xAA40, 0xAA42, 1}, {0xAA43, 0xAA43, 0},
+  {0xAA44, 0xAA4B, 1}, {0xAA4C, 0xAA4D, 0}, {0xAA50, 0xAA59, 0}, {0xAA60, 0xAA76, 1},
+  {0xAA7A, 0xAA7A, 1}, {0xAA7B, 0xAA7D, 0}, {0xAA7E, 0xAAAF, 1}, {0xAAB0, 0xAAB0, 0},
+  {0xAAB1, 0xAAB1, 1}, {0xAAB2, 0xAAB4, 0}, {0xAAB5, 0xAAB6, 1}, {0xAAB7, 0xAAB8, 0},
+  {0xAAB9, 0xAABD, 1}, {0xAABE, 0xAABF, 0}, {0xAAC0, 0xAAC0, 1}, {0xAAC1, 0xAAC1, 0},
+  {0xAAC2, 0xAAC2, 1}, {0xAADB, 0xAADD, 1}, {0xAAE0, 0xAAEA, 1}, {0xAAEB, 0xAAEF, 0},
+  {0xAAF2, 0xAAF4, 1}, {0xAAF5, 0xAAF6, 0}, {0xAB01, 0xAB06, 1}, {0xAB09, 0xAB0E, 1},
+  {0xAB11, 0xAB16, 1}, {0xAB20, 0xAB26, 1}, {0xAB28, 0xAB2E, 1}, {0xAB30, 0xAB5A, 1},
+  {0xAB5C, 0xAB69, 1}, {0xAB70, 0xABE2, 1}, {0xABE3, 0xABEA, 0}, {0xABEC, 0xABED, 0},
+  {0xABF0, 0xABF9, 0}, {0xAC00, 0xD7A3, 1}, {0xD7B0, 0xD7C6, 1}, {0xD7CB, 0xD7FB, 1},
+  {0xF900, 0xFA6D, 1}, {0xFA70, 0xFAD9, 1}, {0xFB00, 0xFB06, 1}, {0xFB13, 0xFB17, 1},
+  {0xFB1D, 0xFB1D, 1}, {0xFB1E, 0xFB1E, 0}, {0xFB1F, 0xFB28, 1}, {0xFB2A, 0xFB36, 1},
+  {0xFB38, 0xFB3C, 1}, {0xFB3E, 0xFB3E, 1}, {0xFB40, 0xFB41, 1}, {0xFB43, 0xFB44, 1},
+  {0xFB46, 0xFBB1, 1}, {0xFBD3, 0xFC5D, 1}, {0xFC64, 0xFD3D, 1}, {0xFD50, 0xFD8F, 1},
+  {0xFD92, 0xFDC7, 1}, {0xFDF0, 0xFDF9, 1}, {0xFE00, 0xFE0F, 0}, {0xFE20, 0xFE2F, 0},
+  {0xFE33, 0xFE34, 0}, {0xFE4D, 0xFE4F, 0}, {0xFE71, 0xFE71, 1}, {0xFE73, 0xFE73, 1},
+  {0xFE77, 0xFE77, 1}, {0xFE79, 0xFE79, 1}, {0xFE7B, 0xFE7B, 1}, {0xFE7D, 0xFE7D, 1},
+  {0xFE7F, 0xFEFC, 1}, {0xFF10, 0xFF19, 0}, {0xFF21, 0xFF3A, 1}, {0xFF3F, 0xFF3F, 0},
+  {0xFF41, 0xFF5A, 1}, {0xFF66, 0xFF9D, 1}, {0xFF9E, 0xFF9F, 0}, {0xFFA0, 0xFFBE, 1},
+  {0xFFC2, 0xFFC7, 1}, {0xFFCA, 0xFFCF, 1}, {0xFFD2, 0xFFD7, 1}, {0xFFDA, 0xFFDC, 1},
+  {0x10000, 0x1000B, 1}, {0x1000D, 0x10026, 1}, {0x10028, 0x1003A, 1}, {0x1003C, 0x1003D, 1},
+  {0x1003F, 0x1004D, 1}, {0x10050, 0x1005D, 1}, {0x10080, 0x100FA, 1}, {0x10140, 0x10174, 1},
+  {0x101FD, 0x101FD, 0}, {0x10280, 0x1029C, 1}, {0x102A0, 0x102D0, 1}, {0x102E0, 0x102E0, 0},
+  {0x10300, 0x1031F, 1}, {0x1032D, 0x1034A, 1}, {0x10350, 0x10375, 1}, {0x10376, 0x1037A, 0},
+  {0x10380, 0x1039D, 1}, {0x103A0, 0x103C3, 1}, {0x103C8, 0x103CF, 1}, {0x103D1, 0x103D5, 1},
+  {0x10400, 0x1049D, 1}, {0x104A0, 0x104A9, 0}, {0x104B0, 0x104D3, 1}, {0x104D8, 0x104FB, 1},
+  {0x10500, 0x10527, 1}, {0x10530, 0x10563, 1}, {0x10570, 0x1057A, 1}, {0x1057C, 0x1058A, 1},
+  {0x1058C, 0x10592, 1}, {0x10594, 0x10595, 1}, {0x10597, 0x105A1, 1}, {0x105A3, 0x105B1, 1},
+  {0x105B3, 0x105B9, 1}, {0x105BB, 0x105BC, 1}, {0x10600, 0x10736, 1}, {0x10740, 0x10755, 1},
+  {0x10760, 0x10767, 1}, {0x10780, 0x10785, 1}, {0x10787, 0x107B0, 1}, {0x107B2, 0x107BA, 1},
+  {0x10800, 0x10805, 1}, {0x10808, 0x10808, 1}, {0x1080A, 0x10835, 1}, {0x10837, 0x10838, 1},
+  {0x1083C, 0x1083C, 1}, {0x1083F, 0x10855, 1}, {0x10860, 0x10876, 1}, {0x10880, 0x1089E, 1},
+  {0x108E0, 0x108F2, 1}, {0x108F4, 0x108F5, 1}, {0x10900, 0x10915, 1}, {0x10920, 0x10939, 1},
+  {0x10980, 0x109B7, 1}, {0x109BE, 0x109BF, 1}, {0x10A00, 0x10A00, 1}, {0x10A01, 0x10A03, 0},
+  {0x10A05, 0x10A06, 0}, {0x10A0C, 0x10A0F, 0}, {0x10A10, 0x10A13, 1}, {0x10A15, 0x10A17, 1},
+  {0x10A19, 0x10A35, 1}, {0x10A38, 0x10A3A, 0}, {0x10A3F, 0x10A3F, 0}, {0x10A60, 0x10A7C, 1},
+  {0x10A80, 0x10A9C, 1}, {0x10AC0, 0x10AC7, 1}, {0x10AC9, 0x10AE4, 1}, {0x10AE5, 0x10AE6, 0},
+  {0x10B00, 0x10B35, 1}, {0x10B40, 0x10B55, 1}, {0x10B60, 0x10B72, 1}, {0x10B80, 0x10B91, 1},
+  {0x10C00, 0x10C48, 1}, {0x10C80, 0x10CB2, 1}, {0x10CC0, 0x10CF2, 1}, {0x10D00, 0x10D23, 1},
+  {0x10D24, 0x10D27, 0}, {0x10D30, 0x10D39, 0}, {0x10E80, 0x10EA9, 1}, {0x10EAB, 0x10EAC, 0},
+  {0x10EB0, 0x10EB1, 1}, {0x10F00, 0x10F1C, 1}, {0x10F27, 0x10F27, 1}, {0x10F30, 0x10F45, 1},
+  {0x10F46, 0x10F50, 0}, {0x10F70, 0x10F81, 1}, {0x10F82, 0x10F85, 0}, {0x10FB0, 0x10FC4, 1},
+  {0x10FE0, 0x10FF6, 1}, {0x11000, 0x11002, 0}, {0x11003, 0x11037, 1}, {0x11038, 0x11046, 0},
+  {0x11066, 0x11070, 0}, {0x11071, 0x11072, 1}, {0x11073, 0x11074, 0}, {0x11075, 0x11075, 1},
+  {0x1107F, 0x11082, 0}, {0x11083, 0x110AF, 1}, {0x110B0, 0x110BA, 0}, {0x110C2, 0x110C2, 0},
+  {0x110D0, 0x110E8, 1}, {0x110F0, 0x110F9, 0}, {0x11100, 0x11102, 0}, {0x11103, 0x11126, 1},
+  {0x11127, 0x11134, 0}, {0x11136, 0x1113F, 0}, {0x11144, 0x11144, 1}, {0x11145, 0x11146, 0},
+  {0x11147, 0x11147, 1}, {0x11150, 0x11172, 1}, {0x11173, 0x11173, 0}, {0x11176, 0x11176, 1},
+  {0x11180, 0x11182, 0}, {0x11183, 0x111B2, 1}, {0x111B3, 0x111C0, 0}, {0x111C1, 0x111C4, 1},
+  {0x111C9, 0x111CC, 0}, {0x111CE, 0x111D9, 0}, {0x111DA, 0x111DA, 1}, {0x111DC, 0x111DC, 1},
+  {0x11200, 0x11211, 1}, {0x11213, 0x1122B, 1}, {0x1122C, 0x11237, 0}, {0x1123E, 0x1123E, 0},
+  {0x11280, 0x11286, 1}, {0x11288, 0x11288, 1}, {0x1128A, 0x1128D, 1}, {0x1128F, 0x1129D, 1},
+  {0x1129F, 0x112A8, 1}, {0x112B0, 0x112DE, 1}, {0x112DF, 0x112EA, 0}, {0x112F0, 0x112F9, 0},
+  {0x11300, 0x11303, 0}, {0x11305, 0x1130C, 1}, {0x1130F, 0x11310, 1}, {0x11313, 0x11328, 1},
+  {0x1132A, 0x11330, 1}, {0x11332, 0x11333, 1}, {0x11335, 0x11339, 1}, {0x1133B, 0x1133C, 0},
+  {0x1133D, 0x1133D, 1}, {0x1133E, 0x11344, 0}, {0x11347, 0x11348, 0}, {0x1134B, 0x1134D, 0},
+  {0x11350, 0x11350, 1}, {0x11357, 0x11357, 0}, {0x1135D, 0x11361, 1}, {0x11362, 0x11363, 0},
+  {0x11366, 0x1136C, 0}, {0x11370, 0x11374, 0}, {0x11400, 0x11434, 1}, {0x11435, 0x11446, 0},
+  {0x11447, 0x1144A, 1}, {0x11450, 0x11459, 0}, {0x1145E, 0x1145E, 0}, {0x1145F, 0x11461, 1},
+  {0x11480, 0x114AF, 1}, {0x114B0, 0x114C3, 0}, {0x114C4, 0x114C5, 1}, {0x114C7, 0x114C7, 1},
+  {0x114D0, 0x114D9, 0}, {0x11580, 0x115AE, 1}, {0x115AF, 0x115B5, 0}, {0x115B8, 0x115C0, 0},
+  {0x115D8, 0x115DB, 1}, {0x115DC, 0x115DD, 0}, {0x11600, 0x1162F, 1}, {0x11630, 0x11640, 0},
+  {0x11644, 0x11644, 1}, {0x11650, 0x11659, 0}, {0x11680, 0x116AA, 1}, {0x116AB, 0x116B7, 0},
+  {0x116B8, 0x116B8, 1}, {0x116C0, 0x116C9, 0}, {0x11700, 0x1171A, 1}, {0x1171D, 0x1172B, 0},
+  {0x11730, 0x11739, 0}, {0x11740, 0x11746, 1}, {0x11800, 0x1182B, 1}, {0x1182C, 0x1183A, 0},
+  {0x118A0, 0x118DF, 1}, {0x118E0, 0x118E9, 0}, {0x118FF, 0x11906, 1}, {0x11909, 0x11909, 1},
+  {0x1190C, 0x11913, 1}, {0x11915, 0x11916, 1}, {0x11918, 0x1192F, 1}, {0x11930, 0x11935, 0},
+  {0x11937, 0x11938, 0}, {0x1193B, 0x1193E, 0}, {0x1193F, 0x1193F, 1}, {0x11940, 0x11940, 0},
+  {0x11941, 0x11941, 1}, {0x11942, 0x11943, 0}, {0x11950, 0x11959, 0}, {0x119A0, 0x119A7, 1},
+  {0x119AA, 0x119D0, 1}, {0x119D1, 0x119D7, 0}, {0x119DA, 0x119E0, 0}, {0x119E1, 0x119E1, 1},
+  {0x119E3, 0x119E3, 1}, {0x119E4, 0x119E4, 0}, {0x11A00, 0x11A00, 1}, {0x11A01, 0x11A0A, 0},
+  {0x11A0B, 0x11A32, 1}, {0x11A33, 0x11A39, 0}, {0x11A3A, 0x11A3A, 1}, {0x11A3B, 0x11A3E, 0},
+  {0x11A47, 0x11A47, 0}, {0x11A50, 0x11A50, 1}, {0x11A51, 0x11A5B, 0}, {0x11A5C, 0x11A89, 1},
+  {0x11A8A, 0x11A99, 0}, {0x11A9D, 0x11A9D, 1}, {0x11AB0, 0x11AF8, 1}, {0x11C00, 0x11C08, 1},
+  {0x11C0A, 0x11C2E, 1}, {0x11C2F, 0x11C36, 0}, {0x11C38, 0x11C3F, 0}, {0x11C40, 0x11C40, 1},
+  {0x11C50, 0x11C59, 0}, {0x11C72, 0x11C8F, 1}, {0x11C92, 0x11CA7, 0}, {0x11CA9, 0x11CB6, 0},
+  {0x11D00, 0x11D06, 1}, {0x11D08, 0x11D09, 1}, {0x11D0B, 0x11D30, 1}, {0x11D31, 0x11D36, 0},
+  {0x11D3A, 0x11D3A, 0}, {0x11D3C, 0x11D3D, 0}, {0x11D3F, 0x11D45, 0}, {0x11D46, 0x11D46, 1},
+  {0x11D47, 0x11D47, 0}, {0x11D50, 0x11D59, 0}, {0x11D60, 0x11D65, 1}, {0x11D67, 0x11D68, 1},
+  {0x11D6A, 0x11D89, 1}, {0x11D8A, 0x11D8E, 0}, {0x11D90, 0x11D91, 0}, {0x11D93, 0x11D97, 0},
+  {0x11D98, 0x11D98, 1}, {0x11DA0, 0x11DA9, 0}, {0x11EE0, 0x11EF2, 1}, {0x11EF3, 0x11EF6, 0},
+  {0x11FB0, 0x11FB0, 1}, {0x12000, 0x12399, 1}, {0x12400, 0x1246E, 1}, {0x12480, 0x12543, 1},
+  {0x12F90, 0x12FF0, 1}, {0x13000, 0x1342E, 1}, {0x14400, 0x14646, 1}, {0x16800, 0x16A38, 1},
+  {0x16A40, 0x16A5E, 1}, {0x16A60, 0x16A69, 0}, {0x16A70, 0x16ABE, 1}, {0x16AC0, 0x16AC9, 0},
+  {0x16AD0, 0x16AED, 1}, {0x16AF0, 0x16AF4, 0}, {0x16B00, 0x16B2F, 1}, {0x16B30, 0x16B36, 0},
+  {0x16B40, 0x16B43, 1}, {0x16B50, 0x16B59, 0}, {0x16B63, 0x16B77, 1}, {0x16B7D, 0x16B8F, 1},
+  {0x16E40, 0x16E7F, 1}, {0x16F00, 0x16F4A, 1}, {0x16F4F, 0x16F4F, 0}, {0x16F50, 0x16F50, 1},
+  {0x16F51, 0x16F87, 0}, {0x16F8F, 0x16F92, 0}, {0x16F93, 0x16F9F, 1}, {0x16FE0, 0x16FE1, 1},
+  {0x16FE3, 0x16FE3, 1}, {0x16FE4, 0x16FE4, 0}, {0x16FF0, 0x16FF1, 0}, {0x17000, 0x187F7, 1},
+  {0x18800, 0x18CD5, 1}, {0x18D00, 0x18D08, 1}, {0x1AFF0, 0x1AFF3, 1}, {0x1AFF5, 0x1AFFB, 1},
+  {0x1AFFD, 0x1AFFE, 1}, {0x1B000, 0x1B122, 1}, {0x1B150, 0x1B152, 1}, {0x1B164, 0x1B167, 1},
+  {0x1B170, 0x1B2FB, 1}, {0x1BC00, 0x1BC6A, 1}, {0x1BC70, 0x1BC7C, 1}, {0x1BC80, 0x1BC88, 1},
+  {0x1BC90, 0x1BC99, 1}, {0x1BC9D, 0x1BC9E, 0}, {0x1CF00, 0x1CF2D, 0}, {0x1CF30, 0x1CF46, 0},
+  {0x1D165, 0x1D169, 0}, {0x1D16D, 0x1D172, 0}, {0x1D17B, 0x1D182, 0}, {0x1D185, 0x1D18B, 0},
+  {0x1D1AA, 0x1D1AD, 0}, {0x1D242, 0x1D244, 0}, {0x1D400, 0x1D454, 1}, {0x1D456, 0x1D49C, 1},
+  {0x1D49E, 0x1D49F, 1}, {0x1D4A2, 0x1D4A2, 1}, {0x1D4A5, 0x1D4A6, 1}, {0x1D4A9, 0x1D4AC, 1},
+  {0x1D4AE, 0x1D4B9, 1}, {0x1D4BB, 0x1D4BB, 1}, {0x1D4BD, 0x1D4C3, 1}, {0x1D4C5, 0x1D505, 1},
+  {0x1D507, 0x1D50A, 1}, {0x1D50D, 0x1D514, 1}, {0x1D516, 0x1D51C, 1}, {0x1D51E, 0x1D539, 1},
+  {0x1D53B, 0x1D53E, 1}, {0x1D540, 0x1D544, 1}, {0x1D546, 0x1D546, 1}, {0x1D54A, 0x1D550, 1},
+  {0x1D552, 0x1D6A5, 1}, {0x1D6A8, 0x1D6C0, 1}, {0x1D6C2, 0x1D6DA, 1}, {0x1D6DC, 0x1D6FA, 1},
+  {0x1D6FC, 0x1D714, 1}, {0x1D716, 0x1D734, 1}, {0x1D736, 0x1D74E, 1}, {0x1D750, 0x1D76E, 1},
+  {0x1D770, 0x1D788, 1}, {0x1D78A, 0x1D7A8, 1}, {0x1D7AA, 0x1D7C2, 1}, {0x1D7C4, 0x1D7CB, 1},
+  {0x1D7CE, 0x1D7FF, 0}, {0x1DA00, 0x1DA36, 0}, {0x1DA3B, 0x1DA6C, 0}, {0x1DA75, 0x1DA75, 0},
+  {0x1DA84, 0x1DA84, 0}, {0x1DA9B, 0x1DA9F, 0}, {0x1DAA1, 0x1DAAF, 0}, {0x1DF00, 0x1DF1E, 1},
+  {0x1E000, 0x1E006, 0}, {0x1E008, 0x1E018, 0}, {0x1E01B, 0x1E021, 0}, {0x1E023, 0x1E024, 0},
+  {0x1E026, 0x1E02A, 0}, {0x1E100, 0x1E12C, 1}, {0x1E130, 0x1E136, 0}, {0x1E137, 0x1E13D, 1},
+  {0x1E140, 0x1E149, 0}, {0x1E14E, 0x1E14E, 1}, {0x1E290, 0x1E2AD, 1}, {0x1E2AE, 0x1E2AE, 0},
+  {0x1E2C0, 0x1E2EB, 1}, {0x1E2EC, 0x1E2F9, 0}, {0x1E7E0, 0x1E7E6, 1}, {0x1E7E8, 0x1E7EB, 1},
+  {0x1E7ED, 0x1E7EE, 1}, {0x1E7F0, 0x1E7FE, 1}, {0x1E800, 0x1E8C4, 1}, {0x1E8D0, 0x1E8D6, 0},
+  {0x1E900, 0x1E943, 1}, {0x1E944, 0x1E94A, 0}, {0x1E94B, 0x1E94B, 1}, {0x1E950, 0x1E959, 0},
+  {0x1EE00, 0x1EE03, 1}, {0x1EE05, 0x1EE1F, 1}, {0x1EE21, 0x1EE22, 1}, {0x1EE24, 0x1EE24, 1},
+  {0x1EE27, 0x1EE27, 1}, {0x1EE29, 0x1EE32, 1}, {0x1EE34, 0x1EE37, 1}, {0x1EE39, 0x1EE39, 1},
+  {0x1EE3B, 0x1EE3B, 1}, {0x1EE42, 0x1EE42, 1}, {0x1EE47, 0x1EE47, 1}, {0x1EE49, 0x1EE49, 1},
+  {0x1EE4B, 0x1EE4B, 1}, {0x1EE4D, 0x1EE4F, 1}, {0x1EE51, 0x1EE52, 1}, {0x1EE54, 0x1EE54, 1},
+  {0x1EE57, 0x1EE57, 1}, {0x1EE59, 0x1EE59, 1}, {0x1EE5B, 0x1EE5B, 1}, {0x1EE5D, 0x1EE5D, 1},
+  {0x1EE5F, 0x1EE5F, 1}, {0x1EE61, 0x1EE62, 1}, {0x1EE64, 0x1EE64, 1}, {0x1EE67, 0x1EE6A, 1},
+  {0x1EE6C, 0x1EE72, 1}, {0x1EE74, 0x1EE77, 1}, {0x1EE79, 0x1EE7C, 1}, {0x1EE7E, 0x1EE7E, 1},
+  {0x1EE80, 0x1EE89, 1}, {0x1EE8B, 0x1EE9B, 1}, {0x1EEA1, 0x1EEA3, 1}, {0x1EEA5, 0x1EEA9, 1},
+  {0x1EEAB, 0x1EEBB, 1}, {0x1FBF0, 0x1FBF9, 0}, {0x20000, 0x2A6DF, 1}, {0x2A700, 0x2B738, 1},
+  {0x2B740, 0x2B81D, 1}, {0x2B820, 0x2CEA1, 1}, {0x2CEB0, 0x2EBE0, 1}, {0x2F800, 0x2FA1D, 1},
+  {0x30000, 0x3134A, 1}, {0xE0100, 0xE01EF, 0}
+};
+
+// Decodes the UTF-8 sequence at p, whose first byte is at least 0x80. Returns its length,
+// or 0 if it is truncated, overlong, a surrogate or above U+10FFFF.
+static SLEX_CONSTEXPR int slex_utf8_decode(const char *p, const char *end, slex_u32 *cp) {
+  unsigned char b = (unsigned char)p[0];
+  int len = 0;
+  slex_u32 min = 0;
+  if(b >= 0xC2 && b <= 0xDF)      { len = 2; *cp = b & 0x1F; min = 0x80; }
+  else if(b >= 0xE0 && b <= 0xEF) { len = 3; *cp = b & 0x0F; min = 0x800; }
+  else if(b >= 0xF0 && b <= 0xF4) { len = 4; *cp = b & 0x07; min = 0x10000; }
+  else return 0;
+
+  if(end - p < len) return 0;
+  for(int i = 1; i < len; i++) {
+    unsigned char c = (unsigned char)p[i];
+    if((c & 0xC0) != 0x80) return 0;
+    *cp = *cp << 6 | (c & 0x3F);
+  }
+  if(*cp < min || *cp > 0x10FFFF || (*cp >= 0xD800 && *cp <= 0xDFFF)) return 0;
+  return len;
+}
+
+// Returns the length of the identifier character at p (its first byte at least 0x80), or 0
+// if it isn't one. With start set only characters that can start an identifier count.
+static SLEX_CONSTEXPR int slex_utf8_ident_len(const char *p, const char *end, slex_bool start) {
+  slex_u32 cp = 0;
+  int len = slex_utf8_decode(p, end, &cp);
+  if(!len) return 0;
+
+  size_t lo = 0;
+  size_t hi = sizeof(slex_xid_ranges) / sizeof(slex_xid_ranges[0]);
+  while(lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if(cp > slex_xid_ranges[mid].last) lo = mid + 1;
+    else hi = mid;
+  }
+  if(lo == sizeof(slex_xid_ranges) / sizeof(slex_xid_ranges[0]) || cp < slex_xid_ranges[lo].first) return 0;
+  if(start && !slex_xid_ranges[lo].start) return 0;
+  return len;
+}
+
+// Continues an identifier over non-ASCII characters, and ASCII ones after them.
+static SLEX_CONSTEXPR void slex_parse_ident_utf8(SlexContext *ctx) {
+  while(ctx->parse_point < ctx->stream_end) {
+    if((unsigned char)*ctx->parse_point < 0x80) {
+      if(!slex_is_ident(*ctx->parse_point)) break;
+      ctx->parse_point++;
+      continue;
+    }
+    int len = slex_utf8_ident_len(ctx->parse_point, ctx->stream_end, 0);
+    if(!len) break;
+    ctx->parse_point += len;
+  }
+}
+
+// Lexes a token starting with a non-ASCII character: an identifier, or the run of non-ASCII
+// characters that don't start one (invalid UTF-8 included) as one SLEX_ERR_unknown_tok.
+// After the error parse_point is left at the last byte of the run, so the usual recovery
+// of skipping a character skips all of it.
+static SLEX_CONSTEXPR slex_bool slex_lex_non_ascii(SlexContext *ctx) {
+  char *p = ctx->parse_point;
+  if(slex_utf8_ident_len(p, ctx->stream_end, 1)) {
+    ctx->tok_ty = SLEX_TOK_identifier;
+    ctx->first_tok_char = p;
+    slex_parse_ident_utf8(ctx);
+    ctx->last_tok_char = ctx->parse_point - 1;
+    return 1;
+  }
+
+  ctx->first_tok_char = p;
+  do {
+    slex_u32 cp = 0;
+    int len = slex_utf8_decode(p, ctx->stream_end, &cp);
+    p += len ? len : 1;
+  } while(p < ctx->stream_end && (unsigned char)*p >= 0x80 && !slex_utf8_ident_len(p, ctx->stream_end, 1));
+  ctx->parse_point = p - 1;
+  return slex_return_err(SLEX_ERR_unknown_tok, ctx);
+}
+
+#endif // SLEX_COMMON_IMPLEMENTATION
+
+static SLEX_CONSTEXPR slex_bool slex_return_eof(SlexContext *ctx) {
+#if SLEX_END_IS_TOKEN
+  ctx->tok_ty = SLEX_TOK_eof;
+  ctx->first_tok_char = ctx->stream_end;
+  ctx->last_tok_char = ctx->stream_end;
+  return 1;
+#else
+  return slex_return_err(SLEX_ERR_unknown_tok, ctx);
+#endif
+}
+
+static SLEX_CONSTEXPR void slex_parse_int_suffix(SlexContext *ctx) {
+  while(SLEX_AVAIL(ctx, 1)) {
+    char c = *ctx->parse_point;
+    if(!(c >= 'a' && c <= 'z') && !(c >= 'A' && c <= 'Z')) break;
+    ctx->parse_point++;
+  }
+  ctx->last_tok_char = ctx->parse_point - 1;
+}
+
+static SLEX_CONSTEXPR slex_bool slex_try_match(SlexContext *ctx, TokenType match_ty, const char *tok, int tok_len) {
+  if (!SLEX_AVAIL(ctx, tok_len)) 
+    return 0;
+
+  for (int i = 0; i < tok_len; i++) {
+    if (ctx->parse_point[i] != tok[i]) {
+      return 0;
+    }
+  }
+
+  ctx->tok_ty = match_ty;
+  ctx->first_tok_char = ctx->parse_point;
+  ctx->last_tok_char = ctx->parse_point + tok_len - 1;
+  ctx->parse_point += tok_len;
+  return 1;
+}
+
+static SLEX_CONSTEXPR slex_bool slex_parse_ident(SlexContext *ctx) {
+  ctx->tok_ty = SLEX_TOK_identifier;
+  ctx->first_tok_char = ctx->parse_point;
+
+  while (SLEX_AVAIL(ctx, 1) && slex_is_ident(*ctx->parse_point)) 
+    ctx->parse_point++;
+
+  // non-ASCII identifier characters are rare, they are handled out of line
+  if(SLEX_AVAIL(ctx, 1) && (unsigned char)*ctx->parse_point >= 0x80)
+    slex_parse_ident_utf8(ctx);
+
+  ctx->last_tok_char = ctx->parse_point - 1;
+  return 1;
+}
+
+static SLEX_CONSTEXPR int slex_parse_exponent(SlexContext *ctx) {
+  if (SLEX_AVAIL(ctx, 1) && (*ctx->parse_point == 'e' || *ctx->parse_point == 'E')) {
+    ctx->parse_point++;
+
+    if(!SLEX_AVAIL(ctx, 1))
+      return slex_return_err(SLEX_ERR_parse, ctx);
+
+    int exp_sign = 1;
+    if (*ctx->parse_point == '-') {
+      exp_sign = -1;
+      ctx->parse_point++;
+    } else if (*ctx->parse_point == '+') {
+      ctx->parse_point++;
+    }
+
+    if (!SLEX_AVAIL(ctx, 1) || !slex_is_numeric(*ctx->parse_point)) {
+      return slex_return_err(SLEX_ERR_parse, ctx);
+    }
+
+    slex_u64 exp = 0;
+    while (SLEX_AVAIL(ctx, 1)) {
+      if (!slex_is_numeric(*ctx->parse_point)) break;
+      int n = *ctx->parse_point - '0';
+
+      if (slex_mul_overflows_u64(exp, 10) || slex_add_overflows_u64(exp, n))
+        return slex_return_err(SLEX_ERR_storage, ctx);
+
+      exp = exp * 10 + n;
+      ctx->parse_point++;
+    }
+    double power = slex_pow(10, exp_sign * (int)exp);
+    if(power == -1)
+      return slex_return_err(SLEX_ERR_storage, ctx);
+    ctx->parsed_float_lit *= power;
+  }
+
+  return 1;
+}
+
+static SLEX_CONSTEXPR int slex_extend_to_float(SlexContext *ctx) {
+  if (!SLEX_AVAIL(ctx, 1)) return 1;
+
+  if (*ctx->parse_point == '.') {
+    ctx->tok_ty = SLEX_TOK_float_lit;
+    ctx->parsed_float_lit = (double)ctx->parsed_int_lit;
+    ctx->parse_point++;
+    slex_u64 num = 0;
+    double divisor = 1.0;
+
+    while (SLEX_AVAIL(ctx, 1)) {
+      if (!slex_is_numeric(*ctx->parse_point)) break;
+      int n = *ctx->parse_point - '0';
+
+      if (slex_mul_overflows_u64(num, 10) || slex_add_overflows_u64(num, n))
+        return slex_return_err(SLEX_ERR_storage, ctx);
+
+      num = num * 10 + n;
+      divisor *= 10.0;
+      ctx->parse_point++;
+    }
+    ctx->parsed_float_lit += num / divisor;
+
+    // Parse exponent if present
+    if (!slex_parse_exponent(ctx))
+      return 0;
+
+    ctx->last_tok_char = ctx->parse_point - 1;
+  } else if (*ctx->parse_point == 'e' || *ctx->parse_point == 'E') {
+    ctx->tok_ty = SLEX_TOK_float_lit;
+    ctx->parsed_float_lit = (double)ctx->parsed_int_lit;
+    if (!slex_parse_exponent(ctx))
+      return 0;
+
+    ctx->last_tok_char = ctx->parse_point - 1;
+  }
+
+  return 1;
+}
+
+static SLEX_CONSTEXPR slex_bool slex_parse_punctuator(SlexContext *ctx) {
+  switch (*ctx->parse_point) {
+    case '[':
+      return slex_consume_single_char(ctx, SLEX_TOK_l_square_paren);
+    case ']':
+      return slex_consume_single_char(ctx, SLEX_TOK_r_square_paren);
+    case '(':
+      return slex_consume_single_char(ctx, SLEX_TOK_l_paren);
+    case ')':
+      return slex_consume_single_char(ctx, SLEX_TOK_r_paren);
+    case '{':
+      return slex_consume_single_char(ctx, SLEX_TOK_l_brace);
+    case '}':
+      return slex_consume_single_char(ctx, SLEX_TOK_r_brace);
+    case '.':
+      if (slex_try_match(ctx, SLEX_TOK_unpack, "...", 3)) return 1;
+#if SLEX_CXX_SUPPORT
+      if (slex_try_match(ctx, SLEX_TOK_member_access, ".*", 2)) return 1;
+#endif
+      return slex_consume_single_char(ctx, SLEX_TOK_period);
+    case '&':
+      if (slex_try_match(ctx, SLEX_TOK_and, "&&", 2)) return 1;
+      if (slex_try_match(ctx, SLEX_TOK_bitwise_and_eq, "&=", 2)) return 1;
+      return slex_consume_single_char(ctx, SLEX_TOK_bitwise_and);
+    case '*':
+      if (slex_try_match(ctx, SLEX_TOK_mul_eq, "*=", 2)) return 1;
+      return slex_consume_single_char(ctx, SLEX_TOK_mul);
+    case '+':
+      if (slex_try_match(ctx, SLEX_TOK_inc, "++", 2)) return 1;
+      if (slex_try_match(ctx, SLEX_TOK_plus_eq, "+=", 2)) return 1;
+      return slex_consume_single_char(ctx, SLEX_TOK_plus);
+    case '-':
+      if (slex_try_match(ctx, SLEX_TOK_arrow, "->", 2)) return 1;
+      if (slex_try_match(ctx, SLEX_TOK_dec, "--", 2)) return 1;
+      if (slex_try_match(ctx, SLEX_TOK_minus_eq, "-=", 2)) return 1;
+#if SLEX_CXX_SUPPORT
+      if (slex_try_match(ctx, SLEX_TOK_deref_access, "->*", 3)) return 1;
+#endif
+      return slex_consume_single_char(ctx, SLEX_TOK_minus);
+    case '~':
+      return slex_consume_single_char(ctx, SLEX_TOK_bitwise_not);
+    case '!':
       if (slex_try_match(ctx, SLEX_TOK_not_eq, "!=", 2)) return 1;
       return slex_consume_single_char(ctx, SLEX_TOK_not);
     case '/':
@@ -401,7 +1629,7 @@ static slex_bool slex_parse_punctuator(SlexContext *ctx) {
   }
 }
 
-static slex_bool slex_skip(SlexContext *ctx) {
+static SLEX_CONSTEXPR slex_bool slex_skip(SlexContext *ctx) {
   while(ctx->parse_point < ctx->stream_end) {
     // preprocessor
 #if SLEX_SKIP_PREPROCESSOR
@@ -415,16 +1643,17 @@ static slex_bool slex_skip(SlexContext *ctx) {
       continue;
     }
 #endif
+#if !SLEX_EMIT_TRIVIA
     // whitespace
     if(slex_is_whitespace(*ctx->parse_point)) {
-      while(ctx->parse_point < ctx->stream_end) {
+      while(SLEX_AVAIL(ctx, 1)) {
         if(!slex_is_whitespace(*ctx->parse_point)) break;
         ctx->parse_point++;
       }
       continue;
     }
 
-    if(ctx->parse_point == ctx->stream_end - 1) {
+    if(!SLEX_AVAIL(ctx, 2)) {
 #if SLEX_SKIP_PREPROCESSOR
       if(*ctx->parse_point == '#') ctx->parse_point++;
 #endif
@@ -434,16 +1663,33 @@ static slex_bool slex_skip(SlexContext *ctx) {
     // comments
     if(*ctx->parse_point == '/' && ctx->parse_point[1] == '/') {
       ctx->parse_point += 2; // skip //
+#if SLEX_PADDED_INPUT
+      ctx->parse_point = slex_find_either_padded(ctx->parse_point, ctx->stream_end, '\n', '\n');
+#else
       while(ctx->parse_point < ctx->stream_end) {
         if(*ctx->parse_point == '\n') break;
         ctx->parse_point++;
       }
+#endif
       ctx->parse_point++;
       continue;
     }
     else if(*ctx->parse_point == '/' && ctx->parse_point[1] == '*') {
       ctx->parse_point += 2;
       slex_bool terminated = 0;
+#if SLEX_PADDED_INPUT
+      // the '\0' after the last * isn't /
+      for(;;) {
+        ctx->parse_point = slex_find_either_padded(ctx->parse_point, ctx->stream_end, '*', '*');
+        if(ctx->parse_point >= ctx->stream_end) break;
+        ctx->parse_point++;
+        if(*ctx->parse_point == '/') {
+          ctx->parse_point++;
+          terminated = 1;
+          break;
+        }
+      }
+#else
       while(ctx->parse_point < ctx->stream_end) {
         if(*ctx->parse_point == '*' 
             && ctx->parse_point <= ctx->stream_end - 2
@@ -454,132 +1700,79 @@ static slex_bool slex_skip(SlexContext *ctx) {
         }
         ctx->parse_point++;
       }
+#endif
       if(!terminated)
         return slex_return_err(SLEX_ERR_parse, ctx);
       continue;
     }
-    else break;
-  }
-  return 1;
-}
-
-static slex_bool slex_parse_ident(SlexContext *ctx) {
-  ctx->tok_ty = SLEX_TOK_identifier;
-  ctx->first_tok_char = ctx->parse_point;
-
-  while (ctx->parse_point < ctx->stream_end && slex_is_ident(*ctx->parse_point)) 
-    ctx->parse_point++;
-
-  ctx->last_tok_char = ctx->parse_point - 1;
-  return 1;
-}
-
-static double slex_pow(double base, int exponent) {
-  if (exponent == 0) return 1.0;
-
-  int is_negative = exponent < 0;
-  if (is_negative) exponent = -exponent;
-
-  double result = 1.0;
-  while (exponent > 0) {
-    if (exponent % 2 == 1) {
-      if(slex_mul_overflows_u64(result, base))
-        return -1;
-      result *= base;
-    }
-    if(slex_mul_overflows_u64(base, base))
-      return -1;
-    base *= base;
-    exponent /= 2;
-  }
-
-  return is_negative ? 1.0 / result : result;
-}
-
-static int slex_parse_exponent(SlexContext *ctx) {
-  if (ctx->parse_point < ctx->stream_end && (*ctx->parse_point == 'e' || *ctx->parse_point == 'E')) {
-    ctx->parse_point++;
-
-    if(ctx->parse_point >= ctx->stream_end)
-      return slex_return_err(SLEX_ERR_parse, ctx);
-
-    int exp_sign = 1;
-    if (*ctx->parse_point == '-') {
-      exp_sign = -1;
-      ctx->parse_point++;
-    } else if (*ctx->parse_point == '+') {
-      ctx->parse_point++;
-    }
-
-    if (ctx->parse_point >= ctx->stream_end || !slex_is_numeric(*ctx->parse_point)) {
-      return slex_return_err(SLEX_ERR_parse, ctx);
-    }
-
-    slex_u64 exp = 0;
-    while (ctx->parse_point < ctx->stream_end) {
-      if (!slex_is_numeric(*ctx->parse_point)) break;
-      int n = *ctx->parse_point - '0';
-
-      if (slex_mul_overflows_u64(exp, 10) || slex_add_overflows_u64(exp, n))
-        return slex_return_err(SLEX_ERR_storage, ctx);
-
-      exp = exp * 10 + n;
-      ctx->parse_point++;
-    }
-    double power = slex_pow(10, exp_sign * (int)exp);
-    if(power == -1)
-      return slex_return_err(SLEX_ERR_storage, ctx);
-    ctx->parsed_float_lit *= power;
+#endif
+    break;
   }
-
   return 1;
 }
 
-static int slex_extend_to_float(SlexContext *ctx) {
-  if (ctx->parse_point >= ctx->stream_end) return 1;
+#if SLEX_EMIT_TRIVIA
+static SLEX_CONSTEXPR slex_bool slex_parse_whitespace(SlexContext *ctx) {
+  ctx->tok_ty = SLEX_TOK_whitespace;
+  ctx->first_tok_char = ctx->parse_point;
 
-  if (*ctx->parse_point == '.') {
-    ctx->tok_ty = SLEX_TOK_float_lit;
-    ctx->parsed_float_lit = (double)ctx->parsed_int_lit;
+  while(SLEX_AVAIL(ctx, 1) && slex_is_whitespace(*ctx->parse_point))
     ctx->parse_point++;
-    slex_u64 num = 0;
-    double divisor = 1.0;
 
-    while (ctx->parse_point < ctx->stream_end) {
-      if (!slex_is_numeric(*ctx->parse_point)) break;
-      int n = *ctx->parse_point - '0';
+  ctx->last_tok_char = ctx->parse_point - 1;
+  return 1;
+}
 
-      if (slex_mul_overflows_u64(num, 10) || slex_add_overflows_u64(num, n))
-        return slex_return_err(SLEX_ERR_storage, ctx);
+// SLEX_TOK_doc_comment or SLEX_TOK_comment for the comment starting at p.
+static SLEX_CONSTEXPR int slex_comment_type(const char *p, const char *end) {
+  p += 2; // skip // or /*
+  slex_bool is_doc;
+  if(p[-1] == '/') // /// is a doc comment, //// is not
+    is_doc = p < end && *p == '/' && !(p + 1 < end && p[1] == '/');
+  else // /** is a doc comment, /**/ and /*** are not
+    is_doc = p + 1 < end && *p == '*' && p[1] != '*' && p[1] != '/';
+  return is_doc ? SLEX_TOK_doc_comment : SLEX_TOK_comment;
+}
 
-      num = num * 10 + n;
-      divisor *= 10.0;
-      ctx->parse_point++;
-    }
-    ctx->parsed_float_lit += num / divisor;
+static SLEX_CONSTEXPR slex_bool slex_parse_comment(SlexContext *ctx) {
+  ctx->first_tok_char = ctx->parse_point;
+  ctx->tok_ty = slex_comment_type(ctx->parse_point, ctx->stream_end);
+  ctx->parse_point += 2; // skip // or /*
 
-    // Parse exponent if present
-    if (!slex_parse_exponent(ctx))
-      return 0;
+  if(ctx->parse_point[-1] == '/') {
+    // the newline is left for the following whitespace token
+#if SLEX_PADDED_INPUT
+    ctx->parse_point = slex_find_either_padded(ctx->parse_point, ctx->stream_end, '\n', '\n');
+#else
+    while(ctx->parse_point < ctx->stream_end && *ctx->parse_point != '\n')
+      ctx->parse_point++;
+#endif
 
     ctx->last_tok_char = ctx->parse_point - 1;
-  } else if (*ctx->parse_point == 'e' || *ctx->parse_point == 'E') {
-    ctx->tok_ty = SLEX_TOK_float_lit;
-    ctx->parsed_float_lit = (double)ctx->parsed_int_lit;
-    if (!slex_parse_exponent(ctx))
-      return 0;
+    return 1;
   }
 
-  return 1;
+  while(ctx->parse_point <= ctx->stream_end - 2) {
+    if(ctx->parse_point[0] == '*' && ctx->parse_point[1] == '/') {
+      ctx->parse_point += 2;
+      ctx->last_tok_char = ctx->parse_point - 1;
+      return 1;
+    }
+    ctx->parse_point++;
+  }
+
+  ctx->parse_point = ctx->stream_end;
+  return slex_return_err(SLEX_ERR_parse, ctx);
 }
+#endif
 
-static slex_bool slex_parse_int_lit(SlexContext *ctx) {
+static SLEX_CONSTEXPR slex_bool slex_parse_int_lit(SlexContext *ctx) {
   ctx->first_tok_char = ctx->parse_point;
   ctx->tok_ty = SLEX_TOK_int_lit;
 
   if (*ctx->parse_point != '0') {
     slex_u64 num = 0;
-    while (ctx->parse_point < ctx->stream_end) {
+    while (SLEX_AVAIL(ctx, 1)) {
       if (!slex_is_numeric(*ctx->parse_point)) break;
 
       int n = *ctx->parse_point - '0';
@@ -603,18 +1796,17 @@ static slex_bool slex_parse_int_lit(SlexContext *ctx) {
     return 1;
   }
 
-  // the current char is the last one
-  if (ctx->parse_point == ctx->stream_end - 1) goto zero;
+  // if the current char is the last one, none of the prefixes below match and it's a zero
 
   // hexadecimals
-  if (ctx->parse_point + 1 < ctx->stream_end && (ctx->parse_point[1] == 'x' || ctx->parse_point[1] == 'X')) {
+  if (SLEX_AVAIL(ctx, 2) && (ctx->parse_point[1] == 'x' || ctx->parse_point[1] == 'X')) {
     ctx->parse_point += 2; // consume 0x
 
     if (ctx->parse_point >= ctx->stream_end) 
       return slex_return_err(SLEX_ERR_parse, ctx);
 
     slex_u64 hex = 0;
-    while (ctx->parse_point < ctx->stream_end) {
+    while (SLEX_AVAIL(ctx, 1)) {
       if (!slex_is_hex(*ctx->parse_point)) break;
 
       int h = slex_hex_to_int(*ctx->parse_point);
@@ -631,230 +1823,1010 @@ static slex_bool slex_parse_int_lit(SlexContext *ctx) {
     if (!slex_extend_to_float(ctx))
       return 0;
 
-#if SLEX_INT_SUFFIXES
-    slex_parse_int_suffix(ctx);
+#if SLEX_INT_SUFFIXES
+    slex_parse_int_suffix(ctx);
+#endif
+    return 1;
+  }
+
+  // octals
+  if (SLEX_AVAIL(ctx, 2) && slex_is_numeric(ctx->parse_point[1])) {
+    slex_u64 oct = 0;
+    while (SLEX_AVAIL(ctx, 1)) {
+      if (!slex_is_oct(*ctx->parse_point)) break;
+
+      int o = *ctx->parse_point - '0';
+
+      if (slex_mul_overflows_u64(oct, 8) || slex_add_overflows_u64(oct * 8, o)) 
+        return slex_return_err(SLEX_ERR_storage, ctx);
+
+      oct = oct * 8 + o;
+      ctx->parse_point++;
+    }
+    ctx->parsed_int_lit = oct;
+    ctx->last_tok_char = ctx->parse_point - 1;
+
+    if (!slex_extend_to_float(ctx))
+      return 0;
+
+#if SLEX_INT_SUFFIXES
+    slex_parse_int_suffix(ctx);
+#endif
+    return 1;
+  }
+
+  if (SLEX_AVAIL(ctx, 2) && ctx->parse_point[1] == 'b') {
+    ctx->parse_point += 2; // consume 0b
+
+    if (ctx->parse_point >= ctx->stream_end) 
+      return slex_return_err(SLEX_ERR_parse, ctx);
+
+    slex_u64 bin = 0;
+    while (SLEX_AVAIL(ctx, 1)) {
+      if (*ctx->parse_point != '0' && *ctx->parse_point != '1') break;
+
+      int b = *ctx->parse_point - '0';
+      if (slex_mul_overflows_u64(bin, 2) || slex_add_overflows_u64(bin * 2, b)) 
+        return slex_return_err(SLEX_ERR_storage, ctx);
+
+      bin = bin * 2 + b;
+      ctx->parse_point++;
+    }
+    ctx->parsed_int_lit = bin;
+    ctx->last_tok_char = ctx->parse_point - 1;
+
+    if (!slex_extend_to_float(ctx))
+      return 0;
+#if SLEX_INT_SUFFIXES
+    slex_parse_int_suffix(ctx);
+#endif
+    return 1;
+  }
+
+  // zero
+  ctx->parsed_int_lit = 0;
+  ctx->last_tok_char = ctx->first_tok_char;
+  ctx->parse_point++;
+  if (!slex_extend_to_float(ctx))
+    return 0;
+#if SLEX_INT_SUFFIXES
+  slex_parse_int_suffix(ctx);
+#endif
+  return 1;
+}
+
+#if SLEX_LAZY_LITERALS
+// Same grammar as slex_parse_exponent, without computing the value.
+static SLEX_CONSTEXPR slex_bool slex_delimit_exponent(SlexContext *ctx) {
+  if (SLEX_AVAIL(ctx, 1) && (*ctx->parse_point == 'e' || *ctx->parse_point == 'E')) {
+    ctx->parse_point++;
+
+    if (SLEX_AVAIL(ctx, 1) && (*ctx->parse_point == '-' || *ctx->parse_point == '+'))
+      ctx->parse_point++;
+
+    if (!SLEX_AVAIL(ctx, 1) || !slex_is_numeric(*ctx->parse_point))
+      return slex_return_err(SLEX_ERR_parse, ctx);
+
+    while (SLEX_AVAIL(ctx, 1) && slex_is_numeric(*ctx->parse_point))
+      ctx->parse_point++;
+  }
+  return 1;
+}
+
+// Same grammar as slex_parse_int_lit and slex_extend_to_float, without computing the value.
+static SLEX_CONSTEXPR slex_bool slex_delimit_number(SlexContext *ctx) {
+  char *p = ctx->parse_point;
+  char *end = ctx->stream_end;
+  ctx->first_tok_char = p;
+  ctx->tok_ty = SLEX_TOK_int_lit;
+
+  if (*p != '0') {
+    while (p < end && slex_is_numeric(*p)) p++;
+  }
+  else if (p == end - 1) {
+    p++;
+  }
+  else if (p[1] == 'x' || p[1] == 'X') {
+    p += 2;
+    if (p >= end) {
+      ctx->parse_point = p;
+      return slex_return_err(SLEX_ERR_parse, ctx);
+    }
+    while (p < end && slex_is_hex(*p)) p++;
+  }
+  else if (slex_is_numeric(p[1])) {
+    while (p < end && slex_is_oct(*p)) p++;
+  }
+  else if (p[1] == 'b') {
+    p += 2;
+    if (p >= end) {
+      ctx->parse_point = p;
+      return slex_return_err(SLEX_ERR_parse, ctx);
+    }
+    while (p < end && (*p == '0' || *p == '1')) p++;
+  }
+  else {
+    p++;
+  }
+  ctx->parse_point = p;
+  ctx->last_tok_char = p - 1;
+
+  if (p < end && (*p == '.' || *p == 'e' || *p == 'E')) {
+    ctx->tok_ty = SLEX_TOK_float_lit;
+    if (*p == '.') {
+      p++;
+      while (p < end && slex_is_numeric(*p)) p++;
+      ctx->parse_point = p;
+    }
+    if (!slex_delimit_exponent(ctx))
+      return 0;
+    ctx->last_tok_char = ctx->parse_point - 1;
+  }
+
+#if SLEX_INT_SUFFIXES
+  slex_parse_int_suffix(ctx);
+#endif
+  return 1;
+}
+
+// Same as slex_continue_char_or_str_lit, without storing anything.
+static SLEX_CONSTEXPR int slex_continue_delimit_char_or_str_lit(SlexContext *ctx, char *limit) {
+  char delim = *ctx->first_tok_char;
+
+  for (;;) {
+    ctx->parse_point = slex_find_either(ctx->parse_point, limit, delim, '\\');
+    if (ctx->parse_point >= limit)
+      break;
+
+    if (*ctx->parse_point == delim) {
+      ctx->last_tok_char = ctx->parse_point;
+      ctx->parse_point++;
+      return 1;
+    }
+
+    if (slex_parse_esc_seq(ctx) == -1)
+      return 0;
+  }
+
+  if (limit < ctx->stream_end)
+    return 2;
+  return slex_return_err(SLEX_ERR_parse, ctx);
+}
+
+// Validates escape sequences like slex_parse_char_or_str_lit, without storing anything.
+static SLEX_CONSTEXPR slex_bool slex_delimit_char_or_str_lit(SlexContext *ctx) {
+  char delim = *ctx->parse_point;
+  ctx->tok_ty = delim == '"' ? SLEX_TOK_str_lit : SLEX_TOK_char_lit;
+  ctx->first_tok_char = ctx->parse_point;
+
+  ctx->parse_point++; // consume " or '
+  return slex_continue_delimit_char_or_str_lit(ctx, ctx->stream_end);
+}
+#endif
+
+SLEX_DEF void slex_init_context(SlexContext *ctx, char *stream_start,
+    char *stream_end, char* string_store, size_t string_store_len) {
+  ctx->parse_point = stream_start;
+  ctx->stream_end = stream_end;
+  ctx->string_store = string_store;
+  ctx->string_store_len = string_store_len;
+  ctx->stream_is_partial = 0;
+  ctx->steps = 0;
+  ctx->resume_state = 0;
+  ctx->resume_digits = 0;
+}
+
+static SLEX_CONSTEXPR int slex_lex_token(SlexContext *ctx) {
+  if(ctx->parse_point >= ctx->stream_end) 
+    return slex_return_eof(ctx);
+
+  if(!slex_skip(ctx))
+    return 0;
+
+  if(ctx->parse_point >= ctx->stream_end) 
+    return slex_return_eof(ctx);
+
+#if SLEX_EMIT_TRIVIA
+  // whitespace and comments
+  if(slex_is_whitespace(*ctx->parse_point))
+    return slex_parse_whitespace(ctx);
+
+  if(*ctx->parse_point == '/' && SLEX_AVAIL(ctx, 2)
+      && (ctx->parse_point[1] == '/' || ctx->parse_point[1] == '*'))
+    return slex_parse_comment(ctx);
+#endif
+
+#if SLEX_LAZY_LITERALS
+  // numbers
+  if(slex_is_numeric(*ctx->parse_point))
+    return slex_delimit_number(ctx);
+
+  // string literals
+  if(*ctx->parse_point == '"' || *ctx->parse_point == '\'')
+    return slex_delimit_char_or_str_lit(ctx);
+#else
+  // numbers
+  if(slex_is_numeric(*ctx->parse_point))
+    return slex_parse_int_lit(ctx);
+
+  // string literals
+  if(*ctx->parse_point == '"' || *ctx->parse_point == '\'')
+    return slex_parse_char_or_str_lit(ctx);
+#endif
+
+  // identifier
+  if(slex_is_ident(*ctx->parse_point)) 
+    return slex_parse_ident(ctx);
+
+  // punctuators
+  if(slex_parse_punctuator(ctx))
+    return 1;
+
+  // non-ASCII: an identifier or a run of other characters
+  if((unsigned char)*ctx->parse_point >= 0x80)
+    return slex_lex_non_ascii(ctx);
+
+  return slex_return_err(SLEX_ERR_unknown_tok, ctx);
+}
+
+SLEX_DEF int slex_get_next_token(SlexContext *ctx) {
+  char *start = ctx->parse_point;
+  int res = slex_lex_token(ctx);
+
+#if SLEX_COUNT_STEPS
+  ctx->steps += (slex_u64)(ctx->parse_point - start) + 1;
+#endif
+
+  if(ctx->stream_is_partial && ctx->stream_end - ctx->parse_point < SLEX_PARTIAL_MARGIN) {
+    ctx->parse_point = start;
+    return slex_return_err(SLEX_ERR_need_input, ctx);
+  }
+  return res;
+}
+
+#if SLEX_LAZY_LITERALS
+#define SLEX_SCAN_DIGIT(ctx, q, max) ((void)(max))
+#else
+// The value of a part of a number overflows past max significant digits, and the lexer stops
+// there with SLEX_ERR_storage, so that is as far as the token goes.
+#define SLEX_SCAN_DIGIT(ctx, q, max) \
+  do { \
+    if((ctx)->resume_digits || *(q) != '0') \
+      if(++(ctx)->resume_digits > (max)) { \
+        *done = 1; \
+        return (q) + 1; \
+      } \
+  } while(0)
+#endif
+
+// Walks the number starting at ctx->resume_start from q up to limit, like slex_delimit_number
+// does, in the phase ctx->resume_state. Returns where it stopped and sets *done when the
+// number ends there, or where the lexer will report an error in it.
+static SLEX_CONSTEXPR char *slex_scan_number(SlexContext *ctx, char *q, char *limit, slex_bool *done) {
+  char *s = ctx->resume_start;
+  char *end = ctx->stream_end;
+
+  for(;;) {
+    switch(ctx->resume_state) {
+      case SLEX_RESUME_number: {
+        // 0x, 0b, 0 and an octal digit, or decimal (a 0 alone takes no more digits)
+        int base = s[0] != '0' || end - s < 2 ? 10 : (s[1] | 0x20) == 'x' ? 16 : s[1] == 'b' ? 2 : 8;
+        size_t max = base == 16 ? 16 : base == 10 ? 20 : base == 8 ? 22 : 64;
+        for(; q < limit && (base == 16 ? slex_is_hex(*q) : base == 10 ? slex_is_numeric(*q) :
+              base == 8 ? slex_is_oct(*q) : *q == '0' || *q == '1'); q++)
+          SLEX_SCAN_DIGIT(ctx, q, max);
+        if(q >= limit && q < end) return q;
+        if(q < end && *q == '.') {
+          q++;
+          ctx->resume_state = SLEX_RESUME_fraction;
+          ctx->resume_digits = 0;
+          continue;
+        }
+        break;
+      }
+      case SLEX_RESUME_fraction:
+        for(; q < limit && slex_is_numeric(*q); q++)
+          SLEX_SCAN_DIGIT(ctx, q, 20);
+        if(q >= limit && q < end) return q;
+        break;
+      case SLEX_RESUME_exponent:
+        for(; q < limit && slex_is_numeric(*q); q++)
+          SLEX_SCAN_DIGIT(ctx, q, 20);
+        if(q >= limit && q < end) return q;
+        ctx->resume_state = SLEX_RESUME_suffix;
+        continue;
+      default:
+#if SLEX_INT_SUFFIXES
+        while(q < limit && ((*q >= 'a' && *q <= 'z') || (*q >= 'A' && *q <= 'Z')))
+          q++;
+        if(q >= limit && q < end) return q;
+#endif
+        *done = 1;
+        return q;
+    }
+
+    // after the digits of the number or its fraction: an exponent or the suffix
+    ctx->resume_state = SLEX_RESUME_suffix;
+    if(q < end && (*q == 'e' || *q == 'E')) {
+      q++;
+      if(q < end && (*q == '+' || *q == '-'))
+        q++;
+      if(q >= end || !slex_is_numeric(*q)) {
+        *done = 1;
+        return q;
+      }
+      ctx->resume_state = SLEX_RESUME_exponent;
+      ctx->resume_digits = 0;
+    }
+  }
+}
+
+#undef SLEX_SCAN_DIGIT
+
+SLEX_DEF int slex_get_next_token_budgeted(SlexContext *ctx, size_t *budget) {
+  // progress kept before something else moved parse_point is stale
+  if(ctx->resume_state && ctx->parse_point != ctx->resume_start)
+    ctx->resume_state = SLEX_RESUME_none;
+
+  for(;;) {
+    char *start = ctx->parse_point;
+    char *end = ctx->stream_end;
+
+    if(!ctx->resume_state) {
+      if(start >= end)
+        return slex_get_next_token(ctx);
+      if(!*budget)
+        return slex_return_err(SLEX_ERR_would_block, ctx);
+
+      char c = *start;
+      int state = SLEX_RESUME_none;
+      size_t opener = 1;
+      if(slex_is_whitespace(c))
+        state = SLEX_RESUME_space;
+      else if(c == '/' && end - start >= 2 && (start[1] == '/' || start[1] == '*')) {
+        state = start[1] == '/' ? SLEX_RESUME_line_comment : SLEX_RESUME_block_comment;
+        opener = 2;
+      }
+      else if(c == '"' || c == '\'')
+        state = SLEX_RESUME_literal;
+      else if(slex_is_numeric(c)) {
+        // 0x and 0b are taken with the first digit
+        state = SLEX_RESUME_number;
+        ctx->resume_digits = c != '0';
+        if(c == '0' && end - start >= 2 && ((start[1] | 0x20) == 'x' || start[1] == 'b'))
+          opener = 2;
+      }
+      else if(slex_is_ident(c))
+        state = SLEX_RESUME_ident;
+      else if((unsigned char)c >= 0x80) {
+        int len = slex_utf8_ident_len(start, end, 1);
+        if(len) {
+          state = SLEX_RESUME_ident;
+        } else {
+          slex_u32 cp = 0;
+          len = slex_utf8_decode(start, end, &cp);
+          state = SLEX_RESUME_non_ascii;
+        }
+        opener = len ? (size_t)len : 1;
+      }
+#if SLEX_SKIP_PREPROCESSOR
+      if(c == '#')
+        state = SLEX_RESUME_directive;
+#endif
+
+      if(!state) {
+        // punctuators and unknown characters are short
+        int res = slex_get_next_token(ctx);
+        size_t used = ctx->parse_point > start ? (size_t)(ctx->parse_point - start) : 0;
+        *budget = used < *budget ? *budget - used : 0;
+        return res;
+      }
+      *budget = opener < *budget ? *budget - opener : 0;
+      ctx->resume_state = state;
+      ctx->resume_start = start;
+      ctx->resume_point = start + opener;
+      ctx->str_len = 0;
+    }
+    else if(!*budget)
+      return slex_return_err(SLEX_ERR_would_block, ctx);
+
+    // walk up to the budget, and on a partial stream not into its last SLEX_PARTIAL_MARGIN bytes
+    char *from = ctx->resume_point;
+    size_t left = from < end ? (size_t)(end - from) : 0;
+    if(ctx->stream_is_partial)
+      left = left > SLEX_PARTIAL_MARGIN ? left - SLEX_PARTIAL_MARGIN : 0;
+    slex_bool needs_input = ctx->stream_is_partial && left <= *budget;
+    char *limit = from + (left < *budget ? left : *budget);
+    char *q = from;
+    slex_bool done = 0;
+    int res = 1;
+
+    switch(ctx->resume_state) {
+      case SLEX_RESUME_space:
+        while(q < limit && slex_is_whitespace(*q))
+          q++;
+        done = q < limit || q >= end;
+        break;
+      case SLEX_RESUME_line_comment:
+        q = slex_find_either(q, limit, '\n', '\n');
+        done = q < limit || q >= end;
+        break;
+      case SLEX_RESUME_block_comment:
+        for(; q < limit; q++) {
+          if(*q == '*' && q + 1 < end && q[1] == '/') {
+            q += 2;
+            done = 1;
+            break;
+          }
+        }
+        if(!done && q >= end) {
+          ctx->resume_state = SLEX_RESUME_none;
+          ctx->parse_point = end;
+          return slex_return_err(SLEX_ERR_parse, ctx);
+        }
+        break;
+      case SLEX_RESUME_directive:
+        while(q < limit && *q != '\n')
+          q += *q == '\\' ? 2 : 1;
+        done = q < limit || q >= end;
+        break;
+      case SLEX_RESUME_literal:
+        ctx->tok_ty = *start == '"' ? SLEX_TOK_str_lit : SLEX_TOK_char_lit;
+        ctx->first_tok_char = start;
+        ctx->parse_point = from;
+#if SLEX_LAZY_LITERALS
+        res = slex_continue_delimit_char_or_str_lit(ctx, limit);
+#else
+        res = slex_continue_char_or_str_lit(ctx, limit);
+#endif
+        q = ctx->parse_point;
+        done = res != 2;
+        if(!done)
+          ctx->parse_point = start;
+        break;
+      case SLEX_RESUME_ident:
+        while(q < limit) {
+          if(slex_is_ident(*q)) {
+            q++;
+            continue;
+          }
+          int len = (unsigned char)*q >= 0x80 ? slex_utf8_ident_len(q, end, 0) : 0;
+          if(!len) break;
+          q += len;
+        }
+        done = q < limit || q >= end;
+        break;
+      case SLEX_RESUME_non_ascii:
+        while(q < limit && (unsigned char)*q >= 0x80 && !slex_utf8_ident_len(q, end, 1)) {
+          slex_u32 cp = 0;
+          int len = slex_utf8_decode(q, end, &cp);
+          q += len ? len : 1;
+        }
+        done = q < limit || q >= end;
+        break;
+      default:
+        q = slex_scan_number(ctx, q, limit, &done);
+        break;
+    }
+
+    size_t used = q > from ? (size_t)(q - from) : 0;
+    *budget = used < *budget ? *budget - used : 0;
+#if SLEX_COUNT_STEPS
+    ctx->steps += used;
 #endif
-    return 1;
-  }
 
-  // octals
-  if (ctx->parse_point + 1 < ctx->stream_end && slex_is_numeric(ctx->parse_point[1])) {
-    slex_u64 oct = 0;
-    while (ctx->parse_point < ctx->stream_end) {
-      if (!slex_is_oct(*ctx->parse_point)) break;
+    if(!done) {
+      ctx->resume_point = q;
+      return slex_return_err(needs_input ? SLEX_ERR_need_input : SLEX_ERR_would_block, ctx);
+    }
 
-      int o = *ctx->parse_point - '0';
+    int state = ctx->resume_state;
+    ctx->resume_state = SLEX_RESUME_none;
+    switch(state) {
+      case SLEX_RESUME_literal:
+        return res;
+      case SLEX_RESUME_ident:
+        ctx->tok_ty = SLEX_TOK_identifier;
+        ctx->first_tok_char = start;
+        ctx->last_tok_char = q - 1;
+        ctx->parse_point = q;
+        return 1;
+      case SLEX_RESUME_non_ascii:
+        // one error for the run, with parse_point on its last byte
+        ctx->first_tok_char = start;
+        ctx->parse_point = q - 1;
+        return slex_return_err(SLEX_ERR_unknown_tok, ctx);
+      case SLEX_RESUME_number:
+      case SLEX_RESUME_fraction:
+      case SLEX_RESUME_exponent:
+      case SLEX_RESUME_suffix:
+        // the lexer computes the value (or reports the error) over what was walked again
+        res = slex_get_next_token(ctx);
+        used = ctx->parse_point > start ? (size_t)(ctx->parse_point - start) : 0;
+        *budget = used < *budget ? *budget - used : 0;
+        return res;
+#if SLEX_EMIT_TRIVIA
+      case SLEX_RESUME_space:
+      case SLEX_RESUME_line_comment:
+      case SLEX_RESUME_block_comment:
+        // the newline after a line comment is left for the following whitespace token
+        ctx->tok_ty = state == SLEX_RESUME_space ? SLEX_TOK_whitespace : slex_comment_type(start, end);
+        ctx->first_tok_char = start;
+        ctx->last_tok_char = q - 1;
+        ctx->parse_point = q;
+        return 1;
+#endif
+    }
+    // skipped, with the newline ending a line comment or a directive
+    ctx->parse_point = state == SLEX_RESUME_space || state == SLEX_RESUME_block_comment ? q : q + 1;
+  }
+}
 
-      if (slex_mul_overflows_u64(oct, 8) || slex_add_overflows_u64(oct * 8, o)) 
-        return slex_return_err(SLEX_ERR_storage, ctx);
+SLEX_DEF int slex_tokenize_budgeted(SlexContext *ctx, SlexToken *tokens, size_t token_cap, size_t byte_budget, size_t *token_count) {
+  size_t count = 0;
 
-      oct = oct * 8 + o;
-      ctx->parse_point++;
+  for(;;) {
+    if(count == token_cap) {
+      *token_count = count;
+      return slex_return_err(SLEX_ERR_would_block, ctx);
     }
-    ctx->parsed_int_lit = oct;
-    ctx->last_tok_char = ctx->parse_point - 1;
+    if(!slex_get_next_token_budgeted(ctx, &byte_budget)) {
+      // without SLEX_END_IS_TOKEN the end is reported as an unknown token
+      if(ctx->tok_ty != SLEX_ERR_unknown_tok || ctx->parse_point < ctx->stream_end) {
+        *token_count = count;
+        return 0;
+      }
+      ctx->tok_ty = SLEX_TOK_eof;
+    }
+    if(ctx->tok_ty == SLEX_TOK_eof) {
+      *token_count = count;
+      return 1;
+    }
+    tokens[count].tok_ty = ctx->tok_ty;
+    tokens[count].first_tok_char = ctx->first_tok_char;
+    tokens[count].last_tok_char = ctx->last_tok_char;
+    count++;
+  }
+}
 
-    if (!slex_extend_to_float(ctx))
-      return 0;
+SLEX_DEF size_t slex_tokenize_batch(const SlexInput *inputs, size_t input_count, SlexToken *tokens, size_t token_cap, SlexBatchResult *results, char *string_store, size_t string_store_len) {
+  SlexContext ctx;
+  size_t tok_count = 0;
+
+  slex_init_context(&ctx, 0, 0, string_store, string_store_len);
+  for(size_t i = 0; i < input_count; i++) {
+    char *begin = inputs[i].begin;
+    SlexBatchResult *res = &results[i];
+    ctx.parse_point = begin;
+    ctx.stream_end = begin + inputs[i].len;
+    res->first_token = tok_count;
+    res->status = SLEX_TOK_eof;
+    res->error_offset = 0;
+
+    for(;;) {
+      if(!slex_get_next_token(&ctx)) {
+        // without SLEX_END_IS_TOKEN the end is reported as an unknown token
+        if(ctx.tok_ty == SLEX_ERR_unknown_tok && ctx.parse_point >= ctx.stream_end) break;
+        res->status = ctx.tok_ty;
+        res->error_offset = (size_t)(ctx.parse_point - begin);
+        break;
+      }
+      if(ctx.tok_ty == SLEX_TOK_eof) break;
 
-#if SLEX_INT_SUFFIXES
-    slex_parse_int_suffix(ctx);
-#endif
-    return 1;
+      if(tok_count == token_cap) {
+        if(i > 0) return i;
+        res->status = SLEX_ERR_storage;
+        res->error_offset = (size_t)(ctx.first_tok_char - begin);
+        break;
+      }
+      tokens[tok_count].tok_ty = ctx.tok_ty;
+      tokens[tok_count].first_tok_char = ctx.first_tok_char;
+      tokens[tok_count].last_tok_char = ctx.last_tok_char;
+      tok_count++;
+    }
+    res->token_count = tok_count - res->first_token;
   }
+  return input_count;
+}
 
-  if (ctx->parse_point + 1 < ctx->stream_end && ctx->parse_point[1] == 'b') {
-    ctx->parse_point += 2; // consume 0b
-
-    if (ctx->parse_point >= ctx->stream_end) 
-      return slex_return_err(SLEX_ERR_parse, ctx);
+SLEX_DEF void slex_init_fingerprinter(SlexFingerprinter *fp, char *stream_begin, size_t k, size_t window) {
+  fp->stream_begin = stream_begin;
+  fp->k = k < 1 ? 1 : k > SLEX_FINGERPRINT_MAX ? SLEX_FINGERPRINT_MAX : k;
+  fp->window = window < 1 ? 1 : window > SLEX_FINGERPRINT_MAX ? SLEX_FINGERPRINT_MAX : window;
+  fp->base_pow = 1;
+  for(size_t i = 1; i < fp->k; i++)
+    fp->base_pow *= SLEX_FINGERPRINT_BASE;
+  fp->hash = 0;
+  fp->token_count = 0;
+  fp->gram_count = 0;
+  fp->last_pick = (size_t)-1;
+  fp->done = 0;
+}
 
-    slex_u64 bin = 0;
-    while (ctx->parse_point < ctx->stream_end) {
-      if (*ctx->parse_point != '0' && *ctx->parse_point != '1') break;
+SLEX_DEF int slex_fingerprint(SlexContext *ctx, SlexFingerprinter *fp, SlexFingerprint *out, size_t out_cap, size_t *out_len) {
+  *out_len = 0;
+  while(!fp->done) {
+    // a token emits at most one fingerprint
+    if(*out_len == out_cap)
+      return slex_return_err(SLEX_ERR_storage, ctx);
 
-      int b = *ctx->parse_point - '0';
-      if (slex_mul_overflows_u64(bin, 2) || slex_add_overflows_u64(bin * 2, b)) 
-        return slex_return_err(SLEX_ERR_storage, ctx);
+    if(!slex_get_next_token(ctx)) {
+      if(ctx->tok_ty == SLEX_ERR_need_input) return 0;
+      if(ctx->parse_point < ctx->stream_end) {
+        ctx->parse_point++;
+        continue;
+      }
+      // without SLEX_END_IS_TOKEN the end is reported as an unknown token
+      ctx->tok_ty = SLEX_TOK_eof;
+    }
 
-      bin = bin * 2 + b;
-      ctx->parse_point++;
+    int norm = ctx->tok_ty;
+    switch(norm) {
+      case SLEX_TOK_eof:
+        if(fp->gram_count > 0 && fp->gram_count < fp->window)
+          slex_fingerprint_pick(fp, fp->gram_count, out, out_len);
+        fp->done = 1;
+        continue;
+      case SLEX_TOK_whitespace:
+      case SLEX_TOK_comment:
+      case SLEX_TOK_doc_comment:
+        continue;
+      case SLEX_TOK_str_lit:
+      case SLEX_TOK_char_lit:
+      case SLEX_TOK_float_lit:
+        norm = SLEX_TOK_int_lit;
+        break;
     }
-    ctx->parsed_int_lit = bin;
-    ctx->last_tok_char = ctx->parse_point - 1;
 
-    if (!slex_extend_to_float(ctx))
-      return 0;
-#if SLEX_INT_SUFFIXES
-    slex_parse_int_suffix(ctx);
-#endif
-    return 1;
+    // rolling hash over the last k normalized tokens
+    size_t slot = fp->token_count % fp->k;
+    slex_u64 value = ((slex_u64)norm + 1) * 0x9E3779B97F4A7C15ull;
+    if(fp->token_count >= fp->k)
+      fp->hash -= fp->token_values[slot] * fp->base_pow;
+    fp->hash = fp->hash * SLEX_FINGERPRINT_BASE + value;
+    fp->token_values[slot] = value;
+    fp->token_offsets[slot] = (size_t)(ctx->first_tok_char - fp->stream_begin);
+    fp->token_count++;
+    if(fp->token_count < fp->k) continue;
+
+    // the k-gram starts at the oldest token, which is in the next slot now
+    slot = fp->gram_count % fp->window;
+    fp->gram_hashes[slot] = fp->hash;
+    fp->gram_offsets[slot] = fp->token_offsets[fp->token_count % fp->k];
+    fp->gram_count++;
+    if(fp->gram_count >= fp->window)
+      slex_fingerprint_pick(fp, fp->window, out, out_len);
   }
-zero:
-  ctx->parsed_int_lit = 0;
-  ctx->last_tok_char = ctx->first_tok_char;
-  ctx->parse_point++;
-  if (!slex_extend_to_float(ctx))
-    return 0;
-#if SLEX_INT_SUFFIXES
-  slex_parse_int_suffix(ctx);
-#endif
   return 1;
 }
 
-static slex_i32 slex_parse_esc_seq(SlexContext *ctx) {
-  ctx->parse_point++; // consume \
-
-  if(ctx->parse_point >= ctx->stream_end) 
-    return slex_return_err(SLEX_ERR_parse, ctx) -1;
+SLEX_DEF void slex_init_directive_scanner(SlexDirectiveScanner *sc, char *stream_start, char *stream_end) {
+  sc->stream_begin = stream_start;
+  sc->parse_point = stream_start;
+  sc->stream_end = stream_end;
+  sc->depth = 0;
+  sc->comment_end = 0;
+}
 
-  if(slex_is_oct(*ctx->parse_point)) {
-    int oct = 0;
-    int i = 0;
-    while(ctx->parse_point < ctx->stream_end && i < 3) {
-      if(!slex_is_oct(*ctx->parse_point)) break;
-      oct = oct * 8 + *ctx->parse_point - '0';
-      ctx->parse_point++;
-      i++;
+SLEX_DEF int slex_next_directive(SlexDirectiveScanner *sc, SlexDirective *d) {
+  char *p = sc->parse_point;
+  char *end = sc->stream_end;
+
+  while(p < end) {
+    p = slex_find_directive_special(p, end);
+    if(p >= end) break;
+
+    if(*p == '#') {
+      if(slex_at_line_start(sc, p)) {
+        // the name is lexed like any token
+        char *line_end = slex_find_line_end(p, end);
+        SlexContext line;
+        slex_init_context(&line, p + 1, line_end, 0, 0);
+        int ok;
+        while((ok = slex_get_next_token(&line)) && (line.tok_ty == SLEX_TOK_whitespace
+            || line.tok_ty == SLEX_TOK_comment || line.tok_ty == SLEX_TOK_doc_comment)) {}
+        if(ok && line.tok_ty == SLEX_TOK_identifier) {
+          d->first_char = p;
+          d->name = line.first_tok_char;
+          d->name_len = (size_t)(line.last_tok_char - line.first_tok_char + 1);
+          sc->parse_point = slex_finish_directive(sc, line_end, d);
+          return 1;
+        }
+      }
+      p++;
+    }
+    else if(*p == '/') {
+      if(p + 1 < end && p[1] == '/') {
+        // like slex_skip, a line comment ends at the next \n
+        p = slex_find_either(p + 2, end, '\n', '\n');
+      }
+      else if(p + 1 < end && p[1] == '*') {
+        slex_bool line_start = slex_at_line_start(sc, p);
+        // look for the / of */, it is rarer than *
+        char *body = p + 2;
+        p = body;
+        for(;;) {
+          p = slex_find_either(p, end, '/', '/');
+          if(p >= end) break;
+          p++;
+          if(p - 2 >= body && p[-2] == '*') break;
+        }
+        if(line_start) sc->comment_end = p;
+      }
+      else {
+        p++;
+      }
+    }
+    else {
+      // string or character literal; an unterminated one (don't) ends at the end of its line
+      char delim = *p;
+      p++;
+      while(p < end && *p != '\n') {
+        if(*p == delim) {
+          p++;
+          break;
+        }
+        p += *p == '\\' ? 2 : 1;
+      }
+      if(p > end) p = end;
     }
-    return oct;
   }
 
-  if(*ctx->parse_point == 'x') {
-    if(ctx->parse_point > ctx->stream_end - 3 || !slex_is_hex(ctx->parse_point[1])) {
-      ctx->parse_point++;
-      return slex_return_err(SLEX_ERR_parse, ctx) -1;
-    }
+  sc->parse_point = end;
+  return 0;
+}
 
-    if(!slex_is_hex(ctx->parse_point[2])) {
-      ctx->parse_point += 2;
-      return slex_return_err(SLEX_ERR_parse, ctx) -1;
+SLEX_DEF int slex_minify(SlexContext *ctx, char *out, size_t out_cap, int keep_directive_lines, size_t *out_len) {
+  size_t len = 0;
+  // the last two tokens written, [first, end) in out
+  size_t p1_first = 0, p1_end = 0, p2_first = 0, p2_end = 0;
+  int p1_ty = -1, p2_ty = -1;
+  // p2 is directly followed by p1 and the lexer had to tell them apart
+  slex_bool p2_joined = 0;
+  char *prev_end = ctx->parse_point;
+  slex_bool in_directive = 0;
+  slex_bool is_define = 0;
+  size_t directive_tokens = 0;
+  // line splices written since p1, and whether a space went before them
+  slex_bool after_splice = 0;
+  slex_bool splice_spaced = 0;
+
+  for(;;) {
+    if(!slex_get_next_token(ctx)) {
+      // without SLEX_END_IS_TOKEN the end is reported as an unknown token
+      if(ctx->tok_ty != SLEX_ERR_unknown_tok || ctx->parse_point < ctx->stream_end) {
+        *out_len = len;
+        return 0;
+      }
+      ctx->tok_ty = SLEX_TOK_eof;
     }
+    if(ctx->tok_ty == SLEX_TOK_eof) break;
+#if SLEX_EMIT_TRIVIA
+    if(ctx->tok_ty == SLEX_TOK_whitespace || ctx->tok_ty == SLEX_TOK_comment || ctx->tok_ty == SLEX_TOK_doc_comment)
+      continue;
+#endif
 
-    int hex = slex_hex_to_int(ctx->parse_point[1]) * 16 + slex_hex_to_int(ctx->parse_point[2]); 
-    ctx->parse_point += 3;
-    return hex;
-  }
+    char *first = ctx->first_tok_char;
+    size_t n = (size_t)(ctx->last_tok_char - first) + 1;
+    slex_bool touching = first == prev_end;
+    char sep = 0;
+    int space = 0;
+
+    if(keep_directive_lines) {
+      // only directives care about line breaks
+      slex_bool broke = p1_ty < 0 ||
+        ((in_directive || ctx->tok_ty == SLEX_TOK_preprocessor) && slex_gap_breaks_line(prev_end, first));
+      if(broke && in_directive) {
+        sep = '\n';
+        in_directive = 0;
+      }
+      if(broke && ctx->tok_ty == SLEX_TOK_preprocessor) {
+        if(len && out[len - 1] != '\n') sep = '\n';
+        in_directive = 1;
+        is_define = 0;
+        directive_tokens = 0;
+      }
 
-  if(*ctx->parse_point == 'u' || *ctx->parse_point == 'U') {
-    slex_i32 codepoint = 0;
-    int i = 0;
-    int len = *ctx->parse_point == 'u' ? 4 : 8;
-    ctx->parse_point++;
+      // A line splice is written with its newline. C joins the lines before it sees the
+      // tokens, so p1 and the token after the splice are kept apart like neighbours.
+      char *nl = ctx->parse_point;
+      if(nl < ctx->stream_end && *nl == '\r') nl++;
+      if(!sep && ctx->tok_ty == SLEX_TOK_backslash && nl < ctx->stream_end && *nl == '\n') {
+        slex_bool spaced = !touching && p1_ty >= 0 && !(after_splice && splice_spaced);
+        if(out_cap - len < (size_t)(spaced ? 3 : 2)) {
+          *out_len = len;
+          return slex_return_err(SLEX_ERR_storage, ctx);
+        }
+        if(spaced) out[len++] = ' ';
+        out[len++] = '\\';
+        out[len++] = '\n';
+        splice_spaced = (after_splice && splice_spaced) || spaced;
+        after_splice = 1;
+        p2_joined = 0;
+        prev_end = ctx->parse_point = nl + 1;
+        continue;
+      }
+    }
 
-    while(ctx->parse_point < ctx->stream_end && i < len) {
-      if(!slex_is_hex(*ctx->parse_point)) break;
-      codepoint = codepoint * 16 + slex_hex_to_int(*ctx->parse_point);
-      ctx->parse_point++;
-      i++;
+    if(!sep && p1_ty >= 0) {
+      space = slex_minify_space(out[p1_end - 1], *first, p1_ty == SLEX_TOK_int_lit || p1_ty == SLEX_TOK_float_lit);
+      if(after_splice) {
+        // the lexer can't tell, the splice is between them
+        space = space && !touching && !splice_spaced;
+      } else if(space == 1 && touching) {
+        // tokens that touch in the input (L"s") touch in C too, only what follows them changed
+        space = 0;
+      }
+      // #define N (1) isn't #define N(1)
+      if(in_directive && is_define && directive_tokens == 3 && ctx->tok_ty == SLEX_TOK_l_paren && !touching &&
+          !(after_splice && splice_spaced))
+        space = 1;
     }
 
-    if(i != len) 
-      return slex_return_err(SLEX_ERR_parse, ctx) -1;
+    if(space == 2) {
+      // write the token right after p1 and see if p1 (and p2 before it) still lex the same
+      if(out_cap - len < n) {
+        *out_len = len;
+        return slex_return_err(SLEX_ERR_storage, ctx);
+      }
+      for(size_t i = 0; i < n; i++) out[len + i] = first[i];
+      for(int k = p2_joined ? 2 : 1; k > 0 && space == 2; k--) {
+        char *tok_first = out + (k == 2 ? p2_first : p1_first);
+        char *tok_last = out + (k == 2 ? p2_end : p1_end) - 1;
+        SlexContext alone;
+        slex_init_context(&alone, tok_first, out + len + n, 0, 0);
+        if(!slex_get_next_token(&alone) || alone.tok_ty != (k == 2 ? p2_ty : p1_ty) ||
+            alone.first_tok_char != tok_first || alone.last_tok_char != tok_last)
+          space = 1;
+      }
+    }
+    if(space == 1) sep = ' ';
 
-    return codepoint;
+    if(out_cap - len < n + (sep ? 1 : 0)) {
+      *out_len = len;
+      return slex_return_err(SLEX_ERR_storage, ctx);
+    }
+    if(sep) out[len++] = sep;
+    if(space != 2) {
+      for(size_t i = 0; i < n; i++) out[len + i] = first[i];
+    }
+
+    p2_first = p1_first;
+    p2_end = p1_end;
+    p2_ty = p1_ty;
+    p2_joined = space == 2;
+    p1_first = len;
+    p1_end = len + n;
+    p1_ty = ctx->tok_ty;
+    len += n;
+    prev_end = ctx->last_tok_char + 1;
+    after_splice = 0;
+
+    if(in_directive) {
+      // # define N
+      if(directive_tokens == 1)
+        is_define = n == 6 && first[0] == 'd' && first[1] == 'e' && first[2] == 'f' && first[3] == 'i' &&
+          first[4] == 'n' && first[5] == 'e';
+      directive_tokens++;
+    }
   }
 
-  ctx->parse_point++;
-  switch(ctx->parse_point[-1]) {
-    default: ctx->parse_point--; return slex_return_err(SLEX_ERR_parse, ctx) -1;
-    case 'a': return '\a';
-    case 'b': return '\b';
-    case 'f': return '\f';
-    case 'n': return '\n';
-    case 'r': return '\r';
-    case 't': return '\t';
-    case 'v': return '\v';
-    case '\\': return '\\';
-    case '\'': return '\'';
-    case '"': return '"';
-    case '?': return '\?';
+  // the last directive ends its line, if it did in the input
+  if(in_directive && slex_gap_breaks_line(prev_end, ctx->stream_end)) {
+    if(out_cap == len) {
+      *out_len = len;
+      return slex_return_err(SLEX_ERR_storage, ctx);
+    }
+    out[len++] = '\n';
   }
+  *out_len = len;
+  return 1;
 }
 
-static slex_bool slex_parse_char_or_str_lit(SlexContext *ctx) {
-  int curr_str_idx = 0;
+SLEX_DEF int slex_skip_balanced(SlexContext *ctx) {
+  char open;
+  char close;
 
-  char delim = *ctx->parse_point;
-  ctx->tok_ty = delim == '"' ? SLEX_TOK_str_lit : SLEX_TOK_char_lit;
-  ctx->first_tok_char = ctx->parse_point;
+  switch(ctx->tok_ty) {
+    case SLEX_TOK_l_brace:        open = '{'; close = '}'; break;
+    case SLEX_TOK_l_paren:        open = '('; close = ')'; break;
+    case SLEX_TOK_l_square_paren: open = '['; close = ']'; break;
+    default: return slex_return_err(SLEX_ERR_parse, ctx);
+  }
 
-  ctx->parse_point++; // consume " or '
+  char *p = ctx->parse_point;
+  char *end = ctx->stream_end;
+  size_t depth = 1;
 
-  while(ctx->parse_point < ctx->stream_end) {
-    if(*ctx->parse_point == delim) {
-      ctx->last_tok_char = ctx->parse_point;
-      ctx->str_len = curr_str_idx;
-      ctx->parse_point++;
-      return 1;
+  while(p < end) {
+    // skip words without any interesting character
+    while(end - p >= 8) {
+      slex_u64 w = slex_load_u64(p);
+      slex_u64 hit = slex_word_has(w, open) | slex_word_has(w, close) |
+        slex_word_has(w, '"') | slex_word_has(w, '\'') | slex_word_has(w, '/');
+#if SLEX_SKIP_PREPROCESSOR
+      hit |= slex_word_has(w, '#');
+#endif
+      if(hit) break;
+      p += 8;
     }
+    if(p >= end) break;
 
-    if(curr_str_idx >= ctx->string_store_len) 
-      return slex_return_err(SLEX_ERR_storage, ctx);
-
-    if(*ctx->parse_point == '\\') {
-      slex_i32 c = slex_parse_esc_seq(ctx);
-      if(c == -1) return 0;
-
-      int len = slex_utf8_encode_esc_seq(ctx, c, ctx->string_store + curr_str_idx);
-      if(len == -1)
-        return slex_return_err(SLEX_ERR_storage, ctx);
-
-      curr_str_idx += len;
+    char c = *p;
+    if(c == open) {
+      depth++;
     }
-    else {
-      ctx->string_store[curr_str_idx] = *ctx->parse_point;
-      ctx->parse_point++;
-      curr_str_idx++;
+    else if(c == close) {
+      if(--depth == 0) {
+        ctx->last_tok_char = p;
+        ctx->parse_point = p + 1;
+        return 1;
+      }
+    }
+    else if(c == '"' || c == '\'') {
+      // literal, \ escapes the next character
+      for(p++;; p += 2) {
+        p = slex_find_either(p, end, c, '\\');
+        if(p >= end || *p == c) break;
+      }
+      if(p >= end) break;
     }
+    else if(c == '/' && p + 1 < end && p[1] == '/') {
+      p = slex_find_either(p + 2, end, '\n', '\n');
+      continue;
+    }
+    else if(c == '/' && p + 1 < end && p[1] == '*') {
+      for(p += 2;; p++) {
+        p = slex_find_either(p, end, '*', '*');
+        if(p >= end - 1 || p[1] == '/') break;
+      }
+      if(p >= end - 1) break;
+      p++; // the / of */
+    }
+#if SLEX_SKIP_PREPROCESSOR
+    else if(c == '#') {
+      // the line is skipped, \ escapes the newline
+      for(p++;; p += 2) {
+        p = slex_find_either(p, end, '\n', '\\');
+        if(p >= end || *p == '\n') break;
+      }
+      if(p >= end) break;
+    }
+#endif
+    p++;
   }
 
+  ctx->parse_point = end;
   return slex_return_err(SLEX_ERR_parse, ctx);
 }
 
-void slex_init_context(SlexContext *ctx, char *stream_start,
-    char *stream_end, char* string_store, int string_store_len) {
-  ctx->parse_point = stream_start;
-  ctx->stream_end = stream_end;
-  ctx->string_store = string_store;
-  ctx->string_store_len = string_store_len;
+SLEX_DEF void slex_get_token_location(const SlexContext *ctx, char *stream_begin, size_t *line_num, size_t *col_num) {
+  SlexLocation loc;
+  slex_init_location(&loc, stream_begin);
+  slex_get_location(&loc, ctx->first_tok_char, line_num, col_num);
 }
 
-int slex_get_next_token(SlexContext *ctx) {
-  if(ctx->parse_point >= ctx->stream_end) 
-    return slex_return_eof(ctx);
-
-  if(!slex_skip(ctx))
-    return 0;
-
-  if(ctx->parse_point >= ctx->stream_end) 
-    return slex_return_eof(ctx);
-
-  // numbers
-  if(slex_is_numeric(*ctx->parse_point))
-    return slex_parse_int_lit(ctx);
-
-  // string literals
-  if(*ctx->parse_point == '"' || *ctx->parse_point == '\'')
-    return slex_parse_char_or_str_lit(ctx);
-
-  // identifier
-  if(slex_is_ident(*ctx->parse_point)) 
-    return slex_parse_ident(ctx);
-
-  // punctuators
-  if(slex_parse_punctuator(ctx))
-    return 1;
-
+SLEX_DEF void slex_get_parse_ptr_location(const SlexContext *ctx, char *stream_begin, size_t *line_num, size_t *col_num) {
+  SlexLocation loc;
+  slex_init_location(&loc, stream_begin);
+  slex_get_location(&loc, ctx->parse_point, line_num, col_num);
+}
 
-  return slex_return_err(SLEX_ERR_unknown_tok, ctx);
+SLEX_DEF void slex_init_location(SlexLocation *loc, char *stream_begin) {
+  loc->stream_begin = stream_begin;
+  loc->pos = stream_begin;
+  loc->line_num = 1;
+  loc->col_num = 1;
 }
 
-void slex_get_token_location(const SlexContext *ctx, char *stream_begin, int *line_num, int *col_num) {
-  int ln = 1;
-  int col = 1;
+SLEX_DEF void slex_get_location(SlexLocation *loc, char *target, size_t *line_num, size_t *col_num) {
+  if(target < loc->pos)
+    slex_init_location(loc, loc->stream_begin);
+
+  size_t ln = loc->line_num;
+  size_t col = loc->col_num;
 
-  for(char *it = stream_begin; it < ctx->first_tok_char; it++) {
+  for(char *it = loc->pos; it < target; it++) {
     if (*it == '\n') {
       ln++;
       col = 1;
@@ -862,24 +2834,110 @@ void slex_get_token_location(const SlexContext *ctx, char *stream_begin, int *li
       col++;
     }
   }
+  loc->pos = target;
+  loc->line_num = ln;
+  loc->col_num = col;
   *line_num = ln;
   *col_num = col;
 }
 
-void slex_get_parse_ptr_location(const SlexContext *ctx, char *stream_begin, int *line_num, int *col_num) {
-  int ln = 1;
-  int col = 1;
+SLEX_DEF int slex_token_int_value(const SlexToken *token, unsigned long long *value) {
+  SlexContext ctx;
 
-  for(char *it = stream_begin; it < ctx->parse_point; it++) {
-    if (*it == '\n') {
-      ln++;
-      col = 1;
-    } else {
-      col++;
-    }
+  if(token->tok_ty != SLEX_TOK_int_lit)
+    return 0;
+
+  // 0x and 0b without digits need the lookahead the lexer had, so they are handled here
+  char *first = token->first_tok_char;
+  if(token->last_tok_char == first + 1 && first[0] == '0' && (first[1] == 'x' || first[1] == 'X' || first[1] == 'b')) {
+    *value = 0;
+    return 1;
   }
-  *line_num = ln;
-  *col_num = col;
+
+  slex_init_context(&ctx, token->first_tok_char, token->last_tok_char + 1, 0, 0);
+  if(!slex_parse_int_lit(&ctx))
+    return 0;
+
+  *value = ctx.parsed_int_lit;
+  return 1;
 }
-#endif // SLEX_IMPLEMENTATION
-#endif // SLEX_H
+
+SLEX_DEF int slex_token_float_value(const SlexToken *token, double *value) {
+  SlexContext ctx;
+
+  if(token->tok_ty != SLEX_TOK_float_lit)
+    return 0;
+
+  slex_init_context(&ctx, token->first_tok_char, token->last_tok_char + 1, 0, 0);
+  if(!slex_parse_int_lit(&ctx))
+    return 0;
+
+  *value = ctx.parsed_float_lit;
+  return 1;
+}
+
+SLEX_DEF int slex_token_decode_string(const SlexToken *token, char *string_store, size_t string_store_len, size_t *str_len) {
+  SlexContext ctx;
+
+  if(token->tok_ty != SLEX_TOK_str_lit && token->tok_ty != SLEX_TOK_char_lit)
+    return 0;
+
+  slex_init_context(&ctx, token->first_tok_char, token->last_tok_char + 1, string_store, string_store_len);
+  if(!slex_parse_char_or_str_lit(&ctx))
+    return 0;
+
+  *str_len = ctx.str_len;
+  return 1;
+}
+#endif // SLEX_IMPLEMENTATION || SLEX_CONSTEXPR_INSTANCE
+
+#undef slex_init_context
+#undef slex_get_next_token
+#undef slex_get_next_token_budgeted
+#undef slex_scan_number
+#undef slex_tokenize_budgeted
+#undef slex_skip_balanced
+#undef slex_tokenize_batch
+#undef slex_init_fingerprinter
+#undef slex_fingerprint
+#undef slex_init_directive_scanner
+#undef slex_next_directive
+#undef slex_minify
+#undef slex_lex_token
+#undef slex_get_token_location
+#undef slex_get_parse_ptr_location
+#undef slex_init_location
+#undef slex_get_location
+#undef slex_return_eof
+#undef slex_parse_punctuator
+#undef slex_skip
+#undef slex_parse_int_lit
+#undef slex_parse_whitespace
+#undef slex_parse_comment
+#undef slex_comment_type
+#undef slex_token_int_value
+#undef slex_token_float_value
+#undef slex_token_decode_string
+#undef slex_delimit_exponent
+#undef slex_delimit_number
+#undef slex_delimit_char_or_str_lit
+#undef slex_continue_delimit_char_or_str_lit
+#undef slex_parse_int_suffix
+#undef slex_try_match
+#undef slex_parse_ident
+#undef slex_parse_exponent
+#undef slex_extend_to_float
+
+#undef SLEX_END_IS_TOKEN
+#undef SLEX_CXX_SUPPORT
+#undef SLEX_INT_SUFFIXES
+#undef SLEX_SKIP_PREPROCESSOR
+#undef SLEX_LAZY_LITERALS
+#undef SLEX_EMIT_TRIVIA
+#undef SLEX_COUNT_STEPS
+#undef SLEX_PADDED_INPUT
+#undef SLEX_AVAIL
+#undef SLEX_PREFIX
+#undef SLEX_DEF
+
+#endif // INSTANCES
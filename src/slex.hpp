@@ -0,0 +1,202 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2024 Viliam Holly
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+// C++20 layer over slex.h. Header only, no SLEX_IMPLEMENTATION needed.
+//
+// The wrapper compiles its own constexpr instance of the lexer (prefix slex_cx_) from the
+// CONFIG macros defined before this header is included, so everything here also works at
+// compile time. Literals are lazy (SLEX_LAZY_LITERALS): tokens are std::string_view spans
+// into the source and values are decoded on demand.
+
+#ifndef SLEX_HPP
+#define SLEX_HPP
+
+#if __cplusplus < 202002L
+#error "slex.hpp requires C++20"
+#endif
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#undef SLEX_LAZY_LITERALS
+#define SLEX_LAZY_LITERALS 1
+#define SLEX_PREFIX slex_cx_
+#define SLEX_CONSTEXPR_INSTANCE
+#include "slex.h"
+#undef SLEX_CONSTEXPR_INSTANCE
+
+namespace slex {
+
+struct Token {
+  TokenType type;
+  // For errors: the character where the error was detected (empty at the end of the input).
+  std::string_view text;
+
+  constexpr bool is_error() const { return type < SLEX_TOK_eof; }
+
+  constexpr SlexToken raw() const {
+    char *first = const_cast<char *>(text.data());
+    return SlexToken{type, first, text.empty() ? first : first + text.size() - 1};
+  }
+
+  // Value of an int literal, empty if it doesn't fit.
+  constexpr std::optional<unsigned long long> int_value() const {
+    SlexToken tok = raw();
+    unsigned long long value = 0;
+    if (!slex_cx_token_int_value(&tok, &value)) return std::nullopt;
+    return value;
+  }
+
+  // Value of a float literal, empty if it doesn't fit.
+  constexpr std::optional<double> float_value() const {
+    SlexToken tok = raw();
+    double value = 0;
+    if (!slex_cx_token_float_value(&tok, &value)) return std::nullopt;
+    return value;
+  }
+
+  // Decodes a string or character literal (UTF-8) into out and returns the length,
+  // empty if out is too small.
+  constexpr std::optional<std::size_t> decode_string(std::span<char> out) const {
+    SlexToken tok = raw();
+    std::size_t len = 0;
+    if (!slex_cx_token_decode_string(&tok, out.data(), out.size(), &len)) return std::nullopt;
+    return len;
+  }
+};
+
+// Tokenizes a source with range-for:
+//
+//   for (slex::Token tok : slex::Lexer(source)) { ... }
+//
+// Whitespace and comments are skipped (unless SLEX_EMIT_TRIVIA) and the end of the input
+// ends the range. An error is yielded as a token with is_error() set; lexing then
+// continues one character after the error.
+class Lexer {
+ public:
+  constexpr explicit Lexer(std::string_view source) : source_(source) {
+    char *begin = const_cast<char *>(source.data());
+    slex_cx_init_context(&ctx_, begin, begin + source.size(), nullptr, 0);
+  }
+
+  // Parses the next token into token. Returns false at the end of the input.
+  constexpr bool next(Token &token) {
+    if (slex_cx_get_next_token(&ctx_)) {
+      if (ctx_.tok_ty == SLEX_TOK_eof) return false;
+      token.type = static_cast<TokenType>(ctx_.tok_ty);
+      token.text = std::string_view(ctx_.first_tok_char, ctx_.last_tok_char - ctx_.first_tok_char + 1);
+      return true;
+    }
+
+    // without SLEX_END_IS_TOKEN the end is reported as an unknown token
+    if (ctx_.tok_ty == SLEX_ERR_unknown_tok && ctx_.parse_point >= ctx_.stream_end) return false;
+
+    bool at_end = ctx_.parse_point >= ctx_.stream_end;
+    token.type = static_cast<TokenType>(ctx_.tok_ty);
+    token.text = std::string_view(at_end ? ctx_.stream_end : ctx_.parse_point, at_end ? 0 : 1);
+    if (!at_end) ctx_.parse_point++;
+    return true;
+  }
+
+  constexpr std::string_view source() const { return source_; }
+  constexpr SlexContext &context() { return ctx_; }
+
+  class iterator {
+   public:
+    using value_type = Token;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr iterator() = default;
+    constexpr explicit iterator(Lexer *lexer) : lexer_(lexer) { ++*this; }
+
+    constexpr const Token &operator*() const { return token_; }
+    constexpr const Token *operator->() const { return &token_; }
+
+    constexpr iterator &operator++() {
+      if (!lexer_->next(token_)) lexer_ = nullptr;
+      return *this;
+    }
+    constexpr void operator++(int) { ++*this; }
+
+    constexpr bool operator==(std::default_sentinel_t) const { return lexer_ == nullptr; }
+
+   private:
+    Lexer *lexer_ = nullptr;
+    Token token_{};
+  };
+
+  constexpr iterator begin() { return iterator(this); }
+  constexpr std::default_sentinel_t end() const { return std::default_sentinel; }
+
+ private:
+  std::string_view source_;
+  SlexContext ctx_{};
+};
+
+// Owns the tokens of a whole source. Move only, so a buffer is never copied by accident.
+class TokenBuffer {
+ public:
+  constexpr TokenBuffer() = default;
+  constexpr TokenBuffer(TokenBuffer &&) = default;
+  constexpr TokenBuffer &operator=(TokenBuffer &&) = default;
+  TokenBuffer(const TokenBuffer &) = delete;
+  TokenBuffer &operator=(const TokenBuffer &) = delete;
+
+  constexpr void push_back(const Token &token) { tokens_.push_back(token); }
+  constexpr void clear() { tokens_.clear(); }
+
+  constexpr std::span<const Token> tokens() const { return tokens_; }
+  constexpr std::size_t size() const { return tokens_.size(); }
+  constexpr const Token &operator[](std::size_t i) const { return tokens_[i]; }
+  constexpr auto begin() const { return tokens_.begin(); }
+  constexpr auto end() const { return tokens_.end(); }
+
+ private:
+  std::vector<Token> tokens_;
+};
+
+// Lexes the whole source into a TokenBuffer.
+constexpr TokenBuffer tokenize(std::string_view source) {
+  TokenBuffer buffer;
+  for (const Token &token : Lexer(source)) buffer.push_back(token);
+  return buffer;
+}
+
+// Counts the tokens of source, handy for sizing std::array at compile time.
+constexpr std::size_t count_tokens(std::string_view source) {
+  std::size_t count = 0;
+  for (const Token &token : Lexer(source)) {
+    (void)token;
+    count++;
+  }
+  return count;
+}
+
+}  // namespace slex
+
+#endif  // SLEX_HPP
@@ -0,0 +1,1023 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2024 Viliam Holly
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+// A lexing server for the processes of one machine (POSIX, Unix domain sockets).
+//
+// The server lexes files on request and keeps the results in a warm cache, one shared
+// memory segment per file holding its packed tokens and its text. Entries are keyed by
+// path, modification time and a hash of the content: an unchanged mtime is a hit without
+// reading the file, and a touched but unchanged file is only hashed again. A client gets
+// the segment as a file descriptor over the socket and maps it read-only, so the tokens are
+// neither serialized nor copied. On Linux segments are sealed against writes, so no client
+// can change the tokens the others get; elsewhere they have mode 0400, which privileged
+// processes can get around. When the segments exceed the memory budget the least recently
+// used ones are dropped; a client that still maps one keeps it valid.
+//
+// The protocol is local by design: file descriptors only pass between processes of the
+// same machine, and the socket is only accessible to its owner.
+//
+// Define SLEX_DAEMON_IMPLEMENTATION in one translation unit, together with SLEX_IMPLEMENTATION.
+// The server compiles its own instance of the lexer (prefix slex_daemon_lexer_) with the
+// default configuration and SLEX_LAZY_LITERALS: clients compute the values from the text,
+// so the server only validates and delimits literals.
+
+#ifndef SLEX_DAEMON_H
+#define SLEX_DAEMON_H
+
+#include <poll.h>
+#include <stddef.h>
+#include "slex.h"
+
+// Bytes of a file the server reads or lexes before it turns to the other clients again.
+#ifndef SLEX_DAEMON_SLICE
+#define SLEX_DAEMON_SLICE (1 << 20)
+#endif
+
+// First bytes of a segment ("SLEX").
+#define SLEX_DAEMON_MAGIC 0x58454C53u
+
+// A token in a segment. Errors and the SLEX_TOK_eof that ends every segment have len 0.
+typedef struct {
+  slex_i32 tok_ty;
+  slex_u32 reserved;
+  slex_u64 offset;     // of the first character in the text
+  slex_u64 len;
+} SlexDaemonToken;
+
+// Start of a segment: the header, the tokens and the text followed by SLEX_PADDING zero
+// bytes (so padded instances can lex it again).
+typedef struct {
+  slex_u32 magic;
+  slex_u32 token_size; // sizeof(SlexDaemonToken), guards against mismatched builds
+  slex_u64 token_count;
+  slex_u64 text_offset;
+  slex_u64 text_len;
+  slex_u64 content_hash;
+} SlexDaemonHeader;
+
+typedef struct {
+  char *path;
+  slex_i64 mtime_sec;
+  slex_i64 mtime_nsec;
+  slex_u64 content_hash;
+  size_t text_len;
+  int fd;              // descriptor of the segment as clients get it
+  size_t segment_size;
+  slex_u64 last_used;
+} SlexDaemonEntry;
+
+typedef struct {
+  // Statistics: files lexed, requests answered from the cache and the bytes cached.
+  size_t lexes;
+  size_t hits;
+  size_t used;
+
+  size_t budget;
+  int listen_fd;
+  int stop_pipe[2];
+  char socket_path[108];
+  SlexDaemonEntry *entries;
+  size_t entry_count;
+  size_t entry_cap;
+  slex_u64 tick;
+  slex_u64 segment_count;
+  struct pollfd *polls; // stop pipe, listener, clients
+  struct SlexDaemonConn *conns; // state of the clients, in the order of their polls
+  size_t client_count;
+  size_t poll_cap;
+} SlexDaemon;
+
+typedef struct {
+  int fd;
+} SlexDaemonClient;
+
+// A lexed file, mapped read-only into the client.
+typedef struct {
+  const SlexDaemonToken *tokens;
+  size_t token_count;
+  const char *text;
+  size_t text_len;
+  void *map;
+  size_t map_len;
+} SlexDaemonLexed;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Description:
+// - This function creates the server's socket. A stale socket file left by a server that
+//   is gone is replaced.
+// Parameters:
+// - daemon: The server to be initialized.
+// - socket_path: Path of the Unix domain socket.
+// - memory_budget: Bytes of segments the cache may keep.
+// Returns:
+// - Returns 1 on success; otherwise, returns 0 and sets errno.
+int slex_daemon_open(SlexDaemon *daemon, const char *socket_path, size_t memory_budget);
+
+// Description:
+// - This function answers requests from any number of clients until slex_daemon_stop.
+//   Client sockets are non-blocking and requests are taken as they come in, so a client
+//   that stalls holds up no other. Files are read and lexed SLEX_DAEMON_SLICE bytes at a
+//   time, in turns with the other clients.
+// Parameters:
+// - daemon: The server.
+// Returns:
+// - Returns 1 when stopped; otherwise (the socket failed) returns 0 and sets errno.
+int slex_daemon_serve(SlexDaemon *daemon);
+
+// Description:
+// - This function makes slex_daemon_serve return. It can be called from another thread and
+//   from a signal handler.
+// Parameters:
+// - daemon: The server.
+void slex_daemon_stop(SlexDaemon *daemon);
+
+// Description:
+// - This function closes the connections, drops the cache and removes the socket.
+// Parameters:
+// - daemon: The server.
+void slex_daemon_close(SlexDaemon *daemon);
+
+// Description:
+// - This function connects to a server.
+// Parameters:
+// - client: The client to be initialized.
+// - socket_path: Path of the server's socket.
+// Returns:
+// - Returns 1 on success; otherwise, returns 0 and sets errno.
+int slex_daemon_connect(SlexDaemonClient *client, const char *socket_path);
+
+// Description:
+// - This function gets the tokens of a file from the server, which lexes it unless it is
+//   cached. Lexing errors are tokens, and the lexer goes on after them.
+// Parameters:
+// - client: The client.
+// - path: The file; relative paths are resolved by the client.
+// - lexed: Output for the mapped result, unmap it with slex_daemon_unmap.
+// Returns:
+// - Returns 1 on success; otherwise, returns 0 and sets errno (like open for a file the
+//   server can't read).
+int slex_daemon_lex(SlexDaemonClient *client, const char *path, SlexDaemonLexed *lexed);
+
+// Description:
+// - This function drops a file from the server's cache, so the next request lexes it again.
+// Parameters:
+// - client: The client.
+// - path: The file, NULL for the whole cache.
+// Returns:
+// - Returns 1 on success; otherwise, returns 0 and sets errno.
+int slex_daemon_invalidate(SlexDaemonClient *client, const char *path);
+
+// Description:
+// - This function closes the connection.
+// Parameters:
+// - client: The client.
+void slex_daemon_disconnect(SlexDaemonClient *client);
+
+// Description:
+// - This function unmaps a result of slex_daemon_lex.
+// Parameters:
+// - lexed: The result.
+void slex_daemon_unmap(SlexDaemonLexed *lexed);
+
+// Description:
+// - This function makes a SlexToken of a packed token, for slex_token_int_value and friends.
+// Parameters:
+// - lexed: The result the token belongs to.
+// - index: Index of the token.
+// - token: Output for the token, pointing into the mapped text.
+void slex_daemon_token(const SlexDaemonLexed *lexed, size_t index, SlexToken *token);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef SLEX_DAEMON_IMPLEMENTATION
+
+#ifndef SLEX_IMPLEMENTATION
+#error "slex_daemon.h: SLEX_DAEMON_IMPLEMENTATION needs SLEX_IMPLEMENTATION in the same translation unit"
+#endif
+
+#define SLEX_PREFIX slex_daemon_lexer_
+#define SLEX_LAZY_LITERALS 1
+#include "slex.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// memfd_create and the seals are only declared with _GNU_SOURCE
+#ifdef __linux__
+#include <sys/syscall.h>
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001u
+#endif
+#ifndef MFD_ALLOW_SEALING
+#define MFD_ALLOW_SEALING 0x0002u
+#endif
+#ifndef F_ADD_SEALS
+#define F_ADD_SEALS 1033
+#define F_SEAL_SEAL 0x0001
+#define F_SEAL_SHRINK 0x0002
+#define F_SEAL_GROW 0x0004
+#define F_SEAL_WRITE 0x0008
+#endif
+#endif
+
+enum {
+  SLEX_DAEMON_LEX = 1,
+  SLEX_DAEMON_INVALIDATE = 2,
+};
+
+// The path follows the request.
+typedef struct {
+  slex_u32 op;
+  slex_u32 path_len;
+} SlexDaemonRequest;
+
+// A lexed file's descriptor comes along with the reply.
+typedef struct {
+  slex_i32 error;
+  slex_u32 reserved;
+  slex_u64 size;
+} SlexDaemonReply;
+
+// FNV-1a, continued from h over the next len bytes.
+#define SLEX_DAEMON_HASH_BASIS 0xCBF29CE484222325ull
+static slex_u64 slex_daemon_hash(slex_u64 h, const char *p, size_t len) {
+  for (size_t i = 0; i < len; i++) h = (h ^ (unsigned char)p[i]) * 0x100000001B3ull;
+  return h;
+}
+
+static slex_bool slex_daemon_send_all(int fd, const void *buf, size_t len) {
+  const char *p = (const char *)buf;
+  while (len) {
+    ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return 0;
+    p += n;
+    len -= (size_t)n;
+  }
+  return 1;
+}
+
+static slex_bool slex_daemon_send_reply(int sock, const SlexDaemonReply *reply, int fd) {
+  struct iovec iov = {(void *)reply, sizeof(*reply)};
+  struct msghdr msg;
+  union {
+    struct cmsghdr align;
+    char buf[CMSG_SPACE(sizeof(int))];
+  } control;
+
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  if (fd >= 0) {
+    memset(&control, 0, sizeof(control));
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+  }
+
+  ssize_t n;
+  do n = sendmsg(sock, &msg, MSG_NOSIGNAL);
+  while (n < 0 && errno == EINTR);
+  // a reply cut in two can't be finished later
+  if (n >= 0 && n != (ssize_t)sizeof(*reply)) errno = EPIPE;
+  return n == (ssize_t)sizeof(*reply);
+}
+
+// A file that has to be read and lexed before its request is answered. Both go a slice at
+// a time (slex_daemon_work), so a large file doesn't hold up the other clients. Files are
+// read, not mapped: one that an editor truncates meanwhile gives what read saw instead of
+// a SIGBUS.
+typedef struct {
+  char *path;
+  struct stat st;      // of the open file
+  int file_fd;         // -1 once the file is read
+  char *text;          // followed by SLEX_PADDING zero bytes once read
+  size_t len;
+  size_t cap;
+  slex_u64 hash;
+  SlexContext ctx;
+  SlexDaemonToken *tokens;
+  size_t token_count;
+  size_t token_cap;
+} SlexDaemonJob;
+
+// A client: its request as far as it came, the file it waits for and the reply that didn't
+// fit in its socket yet.
+struct SlexDaemonConn {
+  int fd;
+  char request[sizeof(SlexDaemonRequest) + PATH_MAX + 1];
+  size_t received;
+  SlexDaemonJob *job;
+  SlexDaemonReply reply;
+  int reply_fd;        // owned, -1 for none
+  slex_bool replying;
+};
+typedef struct SlexDaemonConn SlexDaemonConn;
+
+static void slex_daemon_free_job(SlexDaemonJob *job) {
+  if (!job) return;
+  if (job->file_fd >= 0) close(job->file_fd);
+  free(job->path);
+  free(job->text);
+  free(job->tokens);
+  free(job);
+}
+
+// Opens path for a job; returns NULL and sets errno if it isn't a readable file.
+static SlexDaemonJob *slex_daemon_start_job(const char *path) {
+  SlexDaemonJob *job = (SlexDaemonJob *)calloc(1, sizeof(SlexDaemonJob));
+  if (!job) {
+    errno = ENOMEM;
+    return NULL;
+  }
+  // a FIFO must not block the server
+  job->file_fd = open(path, O_RDONLY | O_NONBLOCK);
+  if (job->file_fd >= 0) fcntl(job->file_fd, F_SETFD, FD_CLOEXEC);
+  if (job->file_fd < 0 || fstat(job->file_fd, &job->st) != 0) {
+    int err = errno;
+    slex_daemon_free_job(job);
+    errno = err;
+    return NULL;
+  }
+  // one byte more than the size, so the read that finds the end needs no room
+  job->cap = (size_t)job->st.st_size + 1;
+  job->text = S_ISREG(job->st.st_mode) ? (char *)malloc(job->cap + SLEX_PADDING) : NULL;
+  job->path = job->text ? strdup(path) : NULL;
+  if (!job->path) {
+    int err = S_ISREG(job->st.st_mode) ? ENOMEM : EINVAL;
+    slex_daemon_free_job(job);
+    errno = err;
+    return NULL;
+  }
+  job->hash = SLEX_DAEMON_HASH_BASIS;
+  return job;
+}
+
+// Reads and hashes a slice of the job's file. Returns 1 at the end of the file, 0 while
+// more is left and -1 (with errno set) if reading fails.
+static int slex_daemon_read_slice(SlexDaemonJob *job) {
+  if (job->len == job->cap) {
+    char *grown = (char *)realloc(job->text, job->cap * 2 + SLEX_PADDING);
+    if (!grown) {
+      errno = ENOMEM;
+      return -1;
+    }
+    job->text = grown;
+    job->cap *= 2;
+  }
+  size_t want = job->cap - job->len;
+  ssize_t got = read(job->file_fd, job->text + job->len, want < SLEX_DAEMON_SLICE ? want : SLEX_DAEMON_SLICE);
+  if (got < 0) return errno == EINTR || errno == EAGAIN ? 0 : -1;
+  if (got > 0) {
+    job->hash = slex_daemon_hash(job->hash, job->text + job->len, (size_t)got);
+    job->len += (size_t)got;
+    return 0;
+  }
+  close(job->file_fd);
+  job->file_fd = -1;
+  memset(job->text + job->len, 0, SLEX_PADDING);
+  slex_daemon_lexer_init_context(&job->ctx, job->text, job->text + job->len, NULL, 0);
+  return 1;
+}
+
+// Lexes a slice of the job's text into the tokens of the usual error loop, ending with
+// SLEX_TOK_eof. Returns 1 when done, 0 while text is left and -1 (with errno set) if the
+// tokens don't fit in memory.
+static int slex_daemon_lex_slice(SlexDaemonJob *job) {
+  SlexContext *ctx = &job->ctx;
+  size_t budget = SLEX_DAEMON_SLICE;
+
+  for (;;) {
+    if (job->token_count == job->token_cap) {
+      size_t cap = job->token_cap ? job->token_cap * 2 : job->len / 4 + 16;
+      SlexDaemonToken *grown = (SlexDaemonToken *)realloc(job->tokens, cap * sizeof(SlexDaemonToken));
+      if (!grown) {
+        errno = ENOMEM;
+        return -1;
+      }
+      job->tokens = grown;
+      job->token_cap = cap;
+    }
+    // literals are only delimited, nothing is stored
+    int ok = slex_daemon_lexer_get_next_token_budgeted(ctx, &budget);
+    if (!ok && ctx->tok_ty == SLEX_ERR_would_block) return 0;
+
+    SlexDaemonToken *t = &job->tokens[job->token_count++];
+    t->reserved = 0;
+    if (ok && ctx->tok_ty == SLEX_TOK_eof) {
+      t->tok_ty = SLEX_TOK_eof;
+      t->len = 0;
+      t->offset = job->len;
+      return 1;
+    }
+    if (!ok) {
+      t->tok_ty = ctx->tok_ty;
+      t->len = 0;
+      t->offset = (slex_u64)(ctx->parse_point - job->text);
+      if (ctx->parse_point < ctx->stream_end) ctx->parse_point++;
+      continue;
+    }
+    t->tok_ty = ctx->tok_ty;
+    t->len = (slex_u64)(ctx->last_tok_char - ctx->first_tok_char + 1);
+    t->offset = (slex_u64)(ctx->first_tok_char - job->text);
+  }
+}
+
+// Creates a segment with the file's tokens and text and returns the descriptor for the
+// clients. On Linux the segment is a memfd sealed against writes and resizing once it is
+// filled, so not even a reopened /proc/self/fd link can change it. Elsewhere it is a POSIX
+// shared memory object of mode 0400, opened a second time without write access and unlinked
+// right away; that keeps out the writes of other processes of the user, not privileged ones.
+static int slex_daemon_build(SlexDaemon *d, const SlexDaemonJob *job, size_t *size) {
+  const SlexDaemonToken *tokens = job->tokens;
+  size_t token_count = job->token_count;
+  const char *text = job->text;
+  size_t len = job->len;
+  slex_u64 hash = job->hash;
+
+  SlexDaemonHeader header = {SLEX_DAEMON_MAGIC, sizeof(SlexDaemonToken), token_count, 0, len, hash};
+  header.text_offset = sizeof(header) + token_count * sizeof(SlexDaemonToken);
+  *size = (size_t)header.text_offset + len + SLEX_PADDING;
+
+  int rw = -1;
+  int ro = -1;
+  slex_bool sealed = 0;
+  char *map = (char *)MAP_FAILED;
+#ifdef SYS_memfd_create
+  rw = (int)syscall(SYS_memfd_create, "slex", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  sealed = rw >= 0;
+#endif
+  if (rw < 0) {
+    char name[64];
+    snprintf(name, sizeof(name), "/slex-%ld-%llu", (long)getpid(), (unsigned long long)++d->segment_count);
+    rw = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0400);
+    ro = rw >= 0 ? shm_open(name, O_RDONLY, 0) : -1;
+    if (rw >= 0) shm_unlink(name);
+    if (ro < 0) goto fail;
+  }
+  if (ftruncate(rw, (off_t)*size) == 0)
+    map = (char *)mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_SHARED, rw, 0);
+  if (map == MAP_FAILED) goto fail;
+
+  // the rest of the segment is already zero
+  memcpy(map, &header, sizeof(header));
+  memcpy(map + sizeof(header), tokens, token_count * sizeof(SlexDaemonToken));
+  memcpy(map + header.text_offset, text, len);
+  munmap(map, *size);
+
+  // writes can only be sealed once no writable mapping is left
+  if (sealed) {
+    if (fcntl(rw, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0) goto fail;
+    ro = rw;
+  }
+  else {
+    close(rw);
+  }
+  d->lexes++;
+  return ro;
+
+fail:;
+  int err = errno;
+  if (ro >= 0) close(ro);
+  if (rw >= 0) close(rw);
+  errno = err;
+  return -1;
+}
+
+static SlexDaemonEntry *slex_daemon_find(SlexDaemon *d, const char *path) {
+  for (size_t i = 0; i < d->entry_count; i++) {
+    if (strcmp(d->entries[i].path, path) == 0) return &d->entries[i];
+  }
+  return NULL;
+}
+
+static void slex_daemon_drop(SlexDaemon *d, SlexDaemonEntry *e) {
+  close(e->fd);
+  free(e->path);
+  d->used -= e->segment_size;
+  *e = d->entries[--d->entry_count];
+}
+
+// Makes room for size bytes, least recently used first.
+static void slex_daemon_evict(SlexDaemon *d, size_t size) {
+  while (d->entry_count && d->used + size > d->budget) {
+    SlexDaemonEntry *oldest = &d->entries[0];
+    for (size_t i = 1; i < d->entry_count; i++) {
+      if (d->entries[i].last_used < oldest->last_used) oldest = &d->entries[i];
+    }
+    slex_daemon_drop(d, oldest);
+  }
+}
+
+// Puts a lexed job in a segment and the segment in the cache. Returns the segment, or -1
+// with reply->error set. *temporary is set for a segment that doesn't fit in the budget; it
+// isn't cached and has to be closed after use.
+static int slex_daemon_store(SlexDaemon *d, SlexDaemonJob *job, SlexDaemonReply *reply, slex_bool *temporary) {
+  size_t size = 0;
+  int fd = slex_daemon_build(d, job, &size);
+  if (fd < 0) {
+    reply->error = errno;
+    return -1;
+  }
+  reply->size = size;
+
+  // the old entry, or one another request made meanwhile
+  SlexDaemonEntry *e = slex_daemon_find(d, job->path);
+  if (e) slex_daemon_drop(d, e);
+  *temporary = 1;
+  if (size > d->budget) return fd;
+  slex_daemon_evict(d, size);
+  if (d->entry_count == d->entry_cap) {
+    size_t cap = d->entry_cap ? d->entry_cap * 2 : 16;
+    SlexDaemonEntry *grown = (SlexDaemonEntry *)realloc(d->entries, cap * sizeof(SlexDaemonEntry));
+    if (!grown) return fd;
+    d->entries = grown;
+    d->entry_cap = cap;
+  }
+  *temporary = 0;
+  e = &d->entries[d->entry_count++];
+  e->path = job->path;
+  job->path = NULL;
+  e->mtime_sec = (slex_i64)job->st.st_mtim.tv_sec;
+  e->mtime_nsec = (slex_i64)job->st.st_mtim.tv_nsec;
+  e->content_hash = job->hash;
+  e->text_len = job->len;
+  e->fd = fd;
+  e->segment_size = size;
+  e->last_used = ++d->tick;
+  d->used += size;
+  return fd;
+}
+
+// Sends a reply and the descriptor fd (-1 for none) that comes with it; owned descriptors
+// are closed once sent. A reply that doesn't fit in the socket waits in the client for
+// POLLOUT. Returns 0 to drop the client.
+static slex_bool slex_daemon_answer(SlexDaemonConn *c, const SlexDaemonReply *reply, int fd, slex_bool owned) {
+  if (slex_daemon_send_reply(c->fd, reply, fd)) {
+    if (owned) close(fd);
+    return 1;
+  }
+  if (errno != EAGAIN && errno != EWOULDBLOCK) {
+    if (owned) close(fd);
+    return 0;
+  }
+  // a cached segment may be evicted before the reply goes out
+  c->reply = *reply;
+  c->reply_fd = fd >= 0 && !owned ? dup(fd) : fd;
+  c->replying = 1;
+  return fd < 0 || c->reply_fd >= 0;
+}
+
+// Does a slice of the client's job and answers the request once it is done. Returns 0 to
+// drop the client.
+static slex_bool slex_daemon_work(SlexDaemon *d, SlexDaemonConn *c) {
+  SlexDaemonJob *job = c->job;
+  SlexDaemonReply reply = {0, 0, 0};
+  int fd = -1;
+  slex_bool temporary = 0;
+
+  if (job->file_fd >= 0) {
+    int res = slex_daemon_read_slice(job);
+    if (res == 0) return 1;
+    SlexDaemonEntry *e = slex_daemon_find(d, job->path);
+    if (res < 0) {
+      reply.error = errno;
+      if (e) slex_daemon_drop(d, e);
+    }
+    else if (e && e->content_hash == job->hash && e->text_len == job->len) {
+      // touched but not changed
+      d->hits++;
+      e->mtime_sec = (slex_i64)job->st.st_mtim.tv_sec;
+      e->mtime_nsec = (slex_i64)job->st.st_mtim.tv_nsec;
+      e->last_used = ++d->tick;
+      reply.size = e->segment_size;
+      fd = e->fd;
+    }
+    else {
+      return 1;
+    }
+  }
+  else {
+    int res = slex_daemon_lex_slice(job);
+    if (res == 0) return 1;
+    if (res < 0) reply.error = errno;
+    else fd = slex_daemon_store(d, job, &reply, &temporary);
+  }
+  slex_daemon_free_job(job);
+  c->job = NULL;
+  return slex_daemon_answer(c, &reply, fd, temporary);
+}
+
+// Receives what came of the client's request. Returns 1 once it is complete, 0 while it
+// isn't and -1 to drop the client.
+static int slex_daemon_receive(SlexDaemonConn *c) {
+  for (;;) {
+    size_t need = sizeof(SlexDaemonRequest);
+    if (c->received >= need) {
+      SlexDaemonRequest req;
+      memcpy(&req, c->request, sizeof(req));
+      if (req.path_len > PATH_MAX) return -1;
+      need += req.path_len;
+      if (c->received == need) return 1;
+    }
+    ssize_t n = recv(c->fd, c->request + c->received, need - c->received, 0);
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return 0;
+    if (n <= 0) return -1;
+    c->received += (size_t)n;
+  }
+}
+
+// Answers the client's complete request from the cache, or starts the job that answers it.
+// Returns 0 to drop the client.
+static slex_bool slex_daemon_handle(SlexDaemon *d, SlexDaemonConn *c) {
+  SlexDaemonRequest req;
+  memcpy(&req, c->request, sizeof(req));
+  char *path = c->request + sizeof(req);
+  path[req.path_len] = '\0';
+  c->received = 0;
+
+  SlexDaemonReply reply = {0, 0, 0};
+  int fd = -1;
+  if (req.op == SLEX_DAEMON_LEX) {
+    SlexDaemonEntry *e = slex_daemon_find(d, path);
+    struct stat st;
+    if (stat(path, &st) != 0) {
+      reply.error = errno;
+      if (e) slex_daemon_drop(d, e);
+    }
+    else if (e && e->text_len == (size_t)st.st_size && e->mtime_sec == (slex_i64)st.st_mtim.tv_sec &&
+             e->mtime_nsec == (slex_i64)st.st_mtim.tv_nsec) {
+      d->hits++;
+      e->last_used = ++d->tick;
+      reply.size = e->segment_size;
+      fd = e->fd;
+    }
+    else if ((c->job = slex_daemon_start_job(path))) {
+      return 1;
+    }
+    else {
+      reply.error = errno;
+      if (e) slex_daemon_drop(d, e);
+    }
+  }
+  else if (req.op == SLEX_DAEMON_INVALIDATE) {
+    SlexDaemonEntry *e;
+    if (req.path_len == 0) {
+      while (d->entry_count) slex_daemon_drop(d, &d->entries[0]);
+    }
+    else if ((e = slex_daemon_find(d, path))) {
+      slex_daemon_drop(d, e);
+    }
+  }
+  else {
+    reply.error = EINVAL;
+  }
+  return slex_daemon_answer(c, &reply, fd, 0);
+}
+
+// Closes the i-th client and moves the last one into its place.
+static void slex_daemon_remove(SlexDaemon *d, size_t i) {
+  SlexDaemonConn *c = &d->conns[i];
+  close(c->fd);
+  if (c->reply_fd >= 0) close(c->reply_fd);
+  slex_daemon_free_job(c->job);
+  d->client_count--;
+  if (i != d->client_count) {
+    *c = d->conns[d->client_count];
+    d->polls[i + 2] = d->polls[d->client_count + 2];
+  }
+}
+
+static int slex_daemon_listen(const char *socket_path, struct sockaddr_un *addr) {
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+  fcntl(fd, F_SETFD, FD_CLOEXEC);
+  if (bind(fd, (struct sockaddr *)addr, sizeof(*addr)) == 0 && chmod(socket_path, 0600) == 0 && listen(fd, 64) == 0)
+    return fd;
+  int err = errno;
+  close(fd);
+  errno = err;
+  return -1;
+}
+
+int slex_daemon_open(SlexDaemon *d, const char *socket_path, size_t memory_budget) {
+  memset(d, 0, sizeof(*d));
+  d->budget = memory_budget;
+  d->listen_fd = -1;
+  d->stop_pipe[0] = d->stop_pipe[1] = -1;
+
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+    errno = ENAMETOOLONG;
+    return 0;
+  }
+  strcpy(addr.sun_path, socket_path);
+
+  d->listen_fd = slex_daemon_listen(socket_path, &addr);
+  if (d->listen_fd < 0 && errno == EADDRINUSE) {
+    // replace the socket of a server that is gone, not of a running one
+    SlexDaemonClient probe;
+    if (slex_daemon_connect(&probe, socket_path)) {
+      slex_daemon_disconnect(&probe);
+      errno = EADDRINUSE;
+      return 0;
+    }
+    if (errno == ECONNREFUSED && unlink(socket_path) == 0)
+      d->listen_fd = slex_daemon_listen(socket_path, &addr);
+  }
+  if (d->listen_fd < 0) return 0;
+  strcpy(d->socket_path, socket_path);
+
+  d->poll_cap = 16;
+  d->polls = (struct pollfd *)malloc(d->poll_cap * sizeof(struct pollfd));
+  d->conns = (SlexDaemonConn *)malloc(d->poll_cap * sizeof(SlexDaemonConn));
+  if (!d->polls || !d->conns || pipe(d->stop_pipe) != 0) {
+    int err = d->polls && d->conns ? errno : ENOMEM;
+    slex_daemon_close(d);
+    errno = err;
+    return 0;
+  }
+  d->polls[0].fd = d->stop_pipe[0];
+  d->polls[1].fd = d->listen_fd;
+  return 1;
+}
+
+int slex_daemon_serve(SlexDaemon *d) {
+  for (;;) {
+    size_t count = d->client_count + 2;
+    slex_bool working = 0;
+    d->polls[0].events = POLLIN;
+    d->polls[1].events = POLLIN;
+    for (size_t i = 0; i < d->client_count; i++) {
+      // a client gets its answer before its next request is taken
+      SlexDaemonConn *c = &d->conns[i];
+      d->polls[i + 2].events = c->job ? 0 : c->replying ? POLLOUT : POLLIN;
+      working |= c->job != NULL;
+    }
+    for (size_t i = 0; i < count; i++) d->polls[i].revents = 0;
+    if (poll(d->polls, (nfds_t)count, working ? 0 : -1) < 0) {
+      if (errno == EINTR) continue;
+      return 0;
+    }
+    if (d->polls[0].revents) return 1;
+
+    // clients go from the back, so removing one doesn't skip another
+    for (size_t i = d->client_count; i-- > 0;) {
+      SlexDaemonConn *c = &d->conns[i];
+      short revents = d->polls[i + 2].revents;
+      slex_bool keep;
+      if (c->job) {
+        keep = !(revents & (POLLERR | POLLHUP | POLLNVAL)) && slex_daemon_work(d, c);
+      }
+      else if (revents & POLLOUT) {
+        int fd = c->reply_fd;
+        c->reply_fd = -1;
+        c->replying = 0;
+        keep = slex_daemon_answer(c, &c->reply, fd, 1);
+      }
+      else if (revents & POLLIN) {
+        int res = slex_daemon_receive(c);
+        keep = res == 0 || (res == 1 && slex_daemon_handle(d, c));
+      }
+      else {
+        keep = !revents;
+      }
+      if (!keep) slex_daemon_remove(d, i);
+    }
+
+    if (d->polls[1].revents & POLLIN) {
+      int client = accept(d->listen_fd, NULL, NULL);
+      if (client < 0) continue;
+      fcntl(client, F_SETFD, FD_CLOEXEC);
+      fcntl(client, F_SETFL, fcntl(client, F_GETFL) | O_NONBLOCK);
+      if (d->client_count + 2 == d->poll_cap) {
+        size_t cap = d->poll_cap * 2;
+        struct pollfd *polls = (struct pollfd *)realloc(d->polls, cap * sizeof(struct pollfd));
+        if (polls) d->polls = polls;
+        SlexDaemonConn *conns = polls ? (SlexDaemonConn *)realloc(d->conns, cap * sizeof(SlexDaemonConn)) : NULL;
+        if (!conns) {
+          close(client);
+          continue;
+        }
+        d->conns = conns;
+        d->poll_cap = cap;
+      }
+      SlexDaemonConn *c = &d->conns[d->client_count];
+      c->fd = client;
+      c->received = 0;
+      c->job = NULL;
+      c->reply_fd = -1;
+      c->replying = 0;
+      d->polls[d->client_count++ + 2].fd = client;
+    }
+  }
+}
+
+void slex_daemon_stop(SlexDaemon *d) {
+  char byte = 0;
+  ssize_t n;
+  do n = write(d->stop_pipe[1], &byte, 1);
+  while (n < 0 && errno == EINTR);
+}
+
+void slex_daemon_close(SlexDaemon *d) {
+  while (d->client_count) slex_daemon_remove(d, d->client_count - 1);
+  while (d->entry_count) slex_daemon_drop(d, &d->entries[0]);
+  if (d->listen_fd >= 0) {
+    close(d->listen_fd);
+    unlink(d->socket_path);
+  }
+  if (d->stop_pipe[0] >= 0) close(d->stop_pipe[0]);
+  if (d->stop_pipe[1] >= 0) close(d->stop_pipe[1]);
+  free(d->entries);
+  free(d->polls);
+  free(d->conns);
+  memset(d, 0, sizeof(*d));
+  d->listen_fd = -1;
+}
+
+int slex_daemon_connect(SlexDaemonClient *c, const char *socket_path) {
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+    errno = ENAMETOOLONG;
+    return 0;
+  }
+  strcpy(addr.sun_path, socket_path);
+
+  c->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (c->fd < 0) return 0;
+  fcntl(c->fd, F_SETFD, FD_CLOEXEC);
+  if (connect(c->fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+    int err = errno;
+    close(c->fd);
+    c->fd = -1;
+    errno = err;
+    return 0;
+  }
+  return 1;
+}
+
+// Sends a request and waits for the reply and its descriptor (-1 if none came).
+static slex_bool slex_daemon_request(SlexDaemonClient *c, slex_u32 op, const char *path, SlexDaemonReply *reply, int *fd) {
+  size_t path_len = path ? strlen(path) : 0;
+  SlexDaemonRequest req = {op, (slex_u32)path_len};
+  if (path_len > PATH_MAX) {
+    errno = ENAMETOOLONG;
+    return 0;
+  }
+  if (!slex_daemon_send_all(c->fd, &req, sizeof(req)) || !slex_daemon_send_all(c->fd, path, path_len))
+    return 0;
+
+  struct iovec iov = {reply, sizeof(*reply)};
+  struct msghdr msg;
+  union {
+    struct cmsghdr align;
+    char buf[CMSG_SPACE(sizeof(int))];
+  } control;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+
+  ssize_t n;
+  do n = recvmsg(c->fd, &msg, MSG_WAITALL);
+  while (n < 0 && errno == EINTR);
+
+  *fd = -1;
+  struct cmsghdr *cmsg = n > 0 ? CMSG_FIRSTHDR(&msg) : NULL;
+  if (cmsg && cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+    memcpy(fd, CMSG_DATA(cmsg), sizeof(int));
+    fcntl(*fd, F_SETFD, FD_CLOEXEC);
+  }
+  if (n != (ssize_t)sizeof(*reply)) {
+    if (*fd >= 0) close(*fd);
+    *fd = -1;
+    if (n >= 0) errno = ECONNRESET;
+    return 0;
+  }
+  return 1;
+}
+
+int slex_daemon_lex(SlexDaemonClient *c, const char *path, SlexDaemonLexed *lexed) {
+  char full[PATH_MAX];
+  SlexDaemonReply reply;
+  int fd;
+  memset(lexed, 0, sizeof(*lexed));
+  if (!realpath(path, full) || !slex_daemon_request(c, SLEX_DAEMON_LEX, full, &reply, &fd)) return 0;
+  if (reply.error || fd < 0) {
+    if (fd >= 0) close(fd);
+    errno = reply.error ? reply.error : EPROTO;
+    return 0;
+  }
+
+  void *map = mmap(NULL, reply.size, PROT_READ, MAP_SHARED, fd, 0);
+  int err = errno;
+  close(fd);
+  if (map == MAP_FAILED) {
+    errno = err;
+    return 0;
+  }
+
+  // the segment comes from another process, check that it holds together
+  const SlexDaemonHeader *h = (const SlexDaemonHeader *)map;
+  slex_u64 size = reply.size;
+  if (size < sizeof(*h) || h->magic != SLEX_DAEMON_MAGIC || h->token_size != sizeof(SlexDaemonToken) ||
+      h->token_count > (size - sizeof(*h)) / sizeof(SlexDaemonToken) ||
+      h->text_offset != sizeof(*h) + h->token_count * sizeof(SlexDaemonToken) ||
+      h->text_len > size - h->text_offset) {
+    munmap(map, reply.size);
+    errno = EPROTO;
+    return 0;
+  }
+  lexed->tokens = (const SlexDaemonToken *)(h + 1);
+  lexed->token_count = (size_t)h->token_count;
+  lexed->text = (const char *)map + h->text_offset;
+  lexed->text_len = (size_t)h->text_len;
+  lexed->map = map;
+  lexed->map_len = (size_t)reply.size;
+  return 1;
+}
+
+int slex_daemon_invalidate(SlexDaemonClient *c, const char *path) {
+  char full[PATH_MAX];
+  SlexDaemonReply reply;
+  int fd;
+  // a file that is gone is dropped under the name it had
+  if (path && realpath(path, full)) path = full;
+  if (!slex_daemon_request(c, SLEX_DAEMON_INVALIDATE, path, &reply, &fd)) return 0;
+  if (fd >= 0) close(fd);
+  if (reply.error) {
+    errno = reply.error;
+    return 0;
+  }
+  return 1;
+}
+
+void slex_daemon_disconnect(SlexDaemonClient *c) {
+  if (c->fd >= 0) close(c->fd);
+  c->fd = -1;
+}
+
+void slex_daemon_unmap(SlexDaemonLexed *lexed) {
+  if (lexed->map) munmap(lexed->map, lexed->map_len);
+  memset(lexed, 0, sizeof(*lexed));
+}
+
+void slex_daemon_token(const SlexDaemonLexed *lexed, size_t index, SlexToken *token) {
+  const SlexDaemonToken *t = &lexed->tokens[index];
+  token->tok_ty = t->tok_ty;
+  token->first_tok_char = (char *)lexed->text + t->offset;
+  token->last_tok_char = token->first_tok_char + (t->len ? t->len - 1 : 0);
+}
+
+#endif // SLEX_DAEMON_IMPLEMENTATION
+#endif // SLEX_DAEMON_H
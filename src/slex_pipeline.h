@@ -0,0 +1,361 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2024 Viliam Holly
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+// Overlapped reading and lexing of large files (POSIX, pthreads).
+//
+// A reader thread reads the file in chunks into a small ring of buffers while the caller
+// lexes. The lexer runs on a partial stream (SlexContext.stream_is_partial) and pulls the
+// next chunk whenever a token could continue past the data it has.
+//
+// slex_map_file maps a whole file instead, for when it fits in the address space. Both keep
+// SLEX_PADDING zero bytes after the input, so they work with SLEX_PADDED_INPUT instances.
+//
+// Define SLEX_PIPELINE_IMPLEMENTATION in one translation unit. The lexer itself comes from
+// slex.h (the default instance unless SLEX_PIPELINE_GET_NEXT_TOKEN names another one).
+
+#ifndef SLEX_PIPELINE_H
+#define SLEX_PIPELINE_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include "slex.h"
+
+// Number of chunks the reader may run ahead (3 = triple buffering).
+#ifndef SLEX_PIPELINE_CHUNKS
+#define SLEX_PIPELINE_CHUNKS 3
+#endif
+
+#ifndef SLEX_PIPELINE_GET_NEXT_TOKEN
+#define SLEX_PIPELINE_GET_NEXT_TOKEN slex_get_next_token
+#endif
+
+typedef struct {
+  // The lexer state. After slex_pipeline_next_token it holds the token like after
+  // slex_get_next_token. Tokens point into the pipeline and stay valid until the next call.
+  SlexContext ctx;
+  // errno of a failed read, 0 otherwise.
+  int io_error;
+
+  int fd;
+  size_t chunk_size;
+
+  // ring of chunks, filled by the reader thread
+  char *chunks;
+  size_t chunk_lens[SLEX_PIPELINE_CHUNKS];
+  int chunk_head;
+  int chunk_count;
+  slex_bool reader_done;
+  slex_bool stop;
+  int reader_error;
+  pthread_mutex_t lock;
+  pthread_cond_t not_empty;
+  pthread_cond_t not_full;
+  pthread_t reader;
+
+  // the unconsumed tail of the previous chunk followed by the current chunk and
+  // SLEX_PADDING zero bytes
+  char *buf;
+  size_t buf_cap;
+} SlexPipeline;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Description:
+// - This function opens a file and starts reading it in the background.
+// Parameters:
+// - pipeline: The pipeline to be initialized.
+// - path: Path of the file to lex.
+// - chunk_size: Size of a single read (1 MB or more is a good choice).
+// - string_store: Pointer to the storage used for parsing strings.
+// - string_store_len: Specifies the length of string_store.
+// Returns:
+// - Returns 1 on success; otherwise, returns 0 and sets pipeline->io_error.
+int slex_pipeline_open(SlexPipeline *pipeline, const char *path, size_t chunk_size, char *string_store, size_t string_store_len);
+
+// Description:
+// - This function parses the next token into pipeline->ctx, waiting for input if needed.
+//   Lexing errors are reported like by slex_get_next_token, so the caller can recover by
+//   advancing pipeline->ctx.parse_point. When reading fails, SLEX_ERR_need_input is returned
+//   and pipeline->io_error is set.
+// Parameters:
+// - pipeline: The pipeline.
+// Returns:
+// - Returns 1 if a token was parsed successfully; otherwise, returns 0.
+int slex_pipeline_next_token(SlexPipeline *pipeline);
+
+// Description:
+// - This function stops the reader thread and frees the pipeline.
+// Parameters:
+// - pipeline: The pipeline.
+void slex_pipeline_close(SlexPipeline *pipeline);
+
+// Description:
+// - This function maps a whole file read-only, followed by SLEX_PADDING zero bytes (the
+//   tail of the last page and fresh zero pages after it, nothing is copied). The file must
+//   not shrink while it is mapped.
+// Parameters:
+// - path: Path of the file.
+// - len: Output pointer for the length of the file.
+// Returns:
+// - Returns the text of the file on success; otherwise, returns NULL and sets errno.
+char *slex_map_file(const char *path, size_t *len);
+
+// Description:
+// - This function unmaps a file mapped by slex_map_file.
+// Parameters:
+// - text: The text returned by slex_map_file.
+// - len: The length of the file.
+void slex_unmap_file(char *text, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef SLEX_PIPELINE_IMPLEMENTATION
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static void *slex_pipeline_reader(void *arg) {
+  SlexPipeline *p = (SlexPipeline *)arg;
+  off_t offset = 0;
+
+  for (;;) {
+    pthread_mutex_lock(&p->lock);
+    while (p->chunk_count == SLEX_PIPELINE_CHUNKS && !p->stop)
+      pthread_cond_wait(&p->not_full, &p->lock);
+    int slot = (p->chunk_head + p->chunk_count) % SLEX_PIPELINE_CHUNKS;
+    slex_bool stop = p->stop;
+    pthread_mutex_unlock(&p->lock);
+    if (stop) break;
+
+    // ask the kernel to start on the chunk after this one
+    posix_fadvise(p->fd, offset + (off_t)p->chunk_size, (off_t)p->chunk_size, POSIX_FADV_WILLNEED);
+
+    char *chunk = p->chunks + (size_t)slot * p->chunk_size;
+    size_t len = 0;
+    int err = 0;
+    slex_bool eof = 0;
+    while (len < p->chunk_size) {
+      ssize_t n = read(p->fd, chunk + len, p->chunk_size - len);
+      if (n < 0) {
+        if (errno == EINTR) continue;
+        err = errno;
+        break;
+      }
+      if (n == 0) {
+        eof = 1;
+        break;
+      }
+      len += (size_t)n;
+    }
+    offset += (off_t)len;
+
+    pthread_mutex_lock(&p->lock);
+    p->chunk_lens[slot] = len;
+    p->chunk_count++;
+    if (eof || err) {
+      p->reader_done = 1;
+      p->reader_error = err;
+    }
+    pthread_cond_signal(&p->not_empty);
+    pthread_mutex_unlock(&p->lock);
+    if (eof || err) break;
+  }
+  return NULL;
+}
+
+// Makes room for len more bytes and the padding after the first used bytes of the buffer.
+static int slex_pipeline_reserve(SlexPipeline *p, size_t used, size_t len) {
+  if (used + len + SLEX_PADDING <= p->buf_cap) return 1;
+  size_t cap = (used + len) * 2 + SLEX_PADDING;
+  char *buf = (char *)realloc(p->buf, cap);
+  if (!buf) {
+    p->io_error = ENOMEM;
+    p->ctx.tok_ty = SLEX_ERR_need_input;
+    return 0;
+  }
+  p->buf = buf;
+  p->buf_cap = cap;
+  return 1;
+}
+
+// Moves the unconsumed input to the front of the buffer and appends the next chunks.
+// A token longer than a chunk is lexed again after every refill, so at least as much
+// input as the held back tail is appended: the total rescanning stays linear.
+static int slex_pipeline_refill(SlexPipeline *p) {
+  size_t tail_len = (size_t)(p->ctx.stream_end - p->ctx.parse_point);
+  if (tail_len) memmove(p->buf, p->ctx.parse_point, tail_len);
+  size_t used = tail_len;
+  slex_bool last = 0;
+
+  do {
+    pthread_mutex_lock(&p->lock);
+    while (p->chunk_count == 0 && !p->reader_done)
+      pthread_cond_wait(&p->not_empty, &p->lock);
+    slex_bool have_chunk = p->chunk_count > 0;
+    int slot = p->chunk_head;
+    size_t len = have_chunk ? p->chunk_lens[slot] : 0;
+    pthread_mutex_unlock(&p->lock);
+
+    if (!have_chunk) {
+      // the reader stopped on an error after all chunks were consumed
+      if (used > tail_len) break;
+      p->io_error = p->reader_error;
+      p->ctx.tok_ty = SLEX_ERR_need_input;
+      return 0;
+    }
+
+    if (!slex_pipeline_reserve(p, used, len)) return 0;
+    if (len) memcpy(p->buf + used, p->chunks + (size_t)slot * p->chunk_size, len);
+    used += len;
+
+    pthread_mutex_lock(&p->lock);
+    p->chunk_head = (p->chunk_head + 1) % SLEX_PIPELINE_CHUNKS;
+    p->chunk_count--;
+    last = p->reader_done && p->chunk_count == 0;
+    pthread_cond_signal(&p->not_full);
+    pthread_mutex_unlock(&p->lock);
+  } while (!last && used - tail_len < tail_len);
+
+  memset(p->buf + used, 0, SLEX_PADDING);
+  p->ctx.parse_point = p->buf;
+  p->ctx.stream_end = p->buf + used;
+  p->ctx.stream_is_partial = !last || p->reader_error;
+  return 1;
+}
+
+int slex_pipeline_open(SlexPipeline *p, const char *path, size_t chunk_size, char *string_store, size_t string_store_len) {
+  memset(p, 0, sizeof(*p));
+
+  p->fd = open(path, O_RDONLY);
+  if (p->fd < 0) {
+    p->io_error = errno;
+    return 0;
+  }
+  posix_fadvise(p->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+  p->chunk_size = chunk_size ? chunk_size : 1;
+  p->chunks = (char *)malloc(p->chunk_size * SLEX_PIPELINE_CHUNKS);
+  if (!p->chunks) {
+    p->io_error = ENOMEM;
+    close(p->fd);
+    return 0;
+  }
+
+  slex_init_context(&p->ctx, p->buf, p->buf, string_store, string_store_len);
+  p->ctx.stream_is_partial = 1;
+
+  pthread_mutex_init(&p->lock, NULL);
+  pthread_cond_init(&p->not_empty, NULL);
+  pthread_cond_init(&p->not_full, NULL);
+  int err = pthread_create(&p->reader, NULL, slex_pipeline_reader, p);
+  if (err) {
+    p->io_error = err;
+    pthread_mutex_destroy(&p->lock);
+    pthread_cond_destroy(&p->not_empty);
+    pthread_cond_destroy(&p->not_full);
+    free(p->chunks);
+    close(p->fd);
+    return 0;
+  }
+  return 1;
+}
+
+int slex_pipeline_next_token(SlexPipeline *p) {
+  for (;;) {
+    if (SLEX_PIPELINE_GET_NEXT_TOKEN(&p->ctx))
+      return 1;
+    if (p->ctx.tok_ty != SLEX_ERR_need_input)
+      return 0;
+    if (!slex_pipeline_refill(p))
+      return 0;
+  }
+}
+
+void slex_pipeline_close(SlexPipeline *p) {
+  pthread_mutex_lock(&p->lock);
+  p->stop = 1;
+  pthread_cond_signal(&p->not_full);
+  pthread_mutex_unlock(&p->lock);
+  pthread_join(p->reader, NULL);
+
+  pthread_mutex_destroy(&p->lock);
+  pthread_cond_destroy(&p->not_empty);
+  pthread_cond_destroy(&p->not_full);
+  free(p->chunks);
+  free(p->buf);
+  close(p->fd);
+}
+
+static size_t slex_map_len(size_t len) {
+  size_t page = (size_t)sysconf(_SC_PAGESIZE);
+  return (len + SLEX_PADDING + page - 1) / page * page;
+}
+
+char *slex_map_file(const char *path, size_t *len) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return NULL;
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    int err = errno;
+    close(fd);
+    errno = err;
+    return NULL;
+  }
+  size_t size = (size_t)st.st_size;
+
+  // zero pages for the padding, the file goes over the front of them
+  char *text = (char *)mmap(NULL, slex_map_len(size), PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (text != MAP_FAILED && size &&
+      mmap(text, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+    int err = errno;
+    munmap(text, slex_map_len(size));
+    errno = err;
+    text = (char *)MAP_FAILED;
+  }
+  int err = errno;
+  close(fd);
+  if (text == MAP_FAILED) {
+    errno = err;
+    return NULL;
+  }
+  if (size) madvise(text, size, MADV_SEQUENTIAL);
+  *len = size;
+  return text;
+}
+
+void slex_unmap_file(char *text, size_t len) {
+  munmap(text, slex_map_len(len));
+}
+
+#endif // SLEX_PIPELINE_IMPLEMENTATION
+#endif // SLEX_PIPELINE_H
@@ -0,0 +1,378 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2024 Viliam Holly
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+// Lexing on one thread and parsing on another (POSIX, pthreads, GCC and Clang atomics).
+//
+// slex_ring_open starts a lexer thread on a buffer. It pushes the tokens into a single
+// producer, single consumer ring and the caller takes them out in batches: slex_ring_acquire
+// returns all tokens that are ready, slex_ring_release hands them back. Both sides only
+// touch an atomic index per batch, no lock is taken per token. The decoded values of string
+// and character literals are copied into an arena next to the ring; a value stays in place
+// until its token is released.
+//
+// Errors are tokens too: tok_ty is the SLEX_ERR_* and first_tok_char points where it
+// happened. The lexer then skips a character and goes on, like the usual error loop. The
+// last token is always SLEX_TOK_eof.
+//
+// Define SLEX_RING_IMPLEMENTATION in one translation unit. The lexer itself comes from
+// slex.h (the default instance unless SLEX_RING_GET_NEXT_TOKEN names another one); it must
+// not use SLEX_LAZY_LITERALS.
+
+#ifndef SLEX_RING_H
+#define SLEX_RING_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include "slex.h"
+
+// Number of tokens the lexer collects before it publishes them.
+#ifndef SLEX_RING_BATCH
+#define SLEX_RING_BATCH 64
+#endif
+
+// How often a waiting side checks the other one before it yields or sleeps.
+#ifndef SLEX_RING_SPINS
+#define SLEX_RING_SPINS 256
+#endif
+
+#ifndef SLEX_RING_GET_NEXT_TOKEN
+#define SLEX_RING_GET_NEXT_TOKEN slex_get_next_token
+#endif
+
+typedef struct {
+  int tok_ty;
+  char *first_tok_char;
+  char *last_tok_char;
+  // value of an int or float literal
+  unsigned long long parsed_int_lit;
+  double parsed_float_lit;
+  // decoded string or character literal, in the arena
+  char *str;
+  size_t str_len;
+  // arena position after the value, for slex_ring_release
+  size_t arena_end;
+} SlexRingToken;
+
+typedef enum {
+  // a waiting side spins, then yields the CPU but keeps polling (lowest latency)
+  SLEX_RING_SPIN,
+  // a waiting side spins, then sleeps until the other side wakes it
+  SLEX_RING_BLOCK,
+} SlexRingWait;
+
+typedef struct {
+  SlexRingToken *tokens;
+  size_t token_mask;
+  char *arena;
+  size_t arena_size;
+  char *string_store;
+  char *stream_begin;
+  char *stream_end;
+  SlexRingWait wait;
+  pthread_t lexer;
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+  int stop;
+
+  // written by the lexer thread, on their own cache line
+  char pad_[64];
+  size_t head;
+  int lexer_waiting;
+
+  // written by the caller
+  char pad2_[64];
+  size_t tail;
+  size_t arena_tail;
+  int caller_waiting;
+  size_t acquired;
+  size_t head_seen;
+  slex_bool done;
+} SlexRing;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Description:
+// - This function starts lexing a buffer on a new thread. The buffer has to stay valid
+//   until slex_ring_close, tokens point into it.
+// Parameters:
+// - ring: The ring to be initialized.
+// - stream_start: Pointer to the first character in the stream.
+// - stream_end: Pointer to the character just past the last character in the stream.
+// - token_cap: Number of tokens in the ring (rounded up to a power of two).
+// - arena_size: Size of the arena for literal values. A string literal longer than half of
+//   it is an SLEX_ERR_storage token.
+// - wait: What a side does when it has to wait for the other one.
+// Returns:
+// - Returns 1 on success; otherwise (out of memory, no thread) returns 0.
+int slex_ring_open(SlexRing *ring, char *stream_start, char *stream_end, size_t token_cap, size_t arena_size, SlexRingWait wait);
+
+// Description:
+// - This function waits for tokens and returns all that are ready, following the ones
+//   acquired before. Release tokens you are done with before acquiring more: the lexer
+//   stops when the ring is full.
+// Parameters:
+// - ring: The ring.
+// - tokens: Output pointer for the first token; the rest follow it.
+// Returns:
+// - Returns the number of tokens, 0 once SLEX_TOK_eof was acquired.
+size_t slex_ring_acquire(SlexRing *ring, SlexRingToken **tokens);
+
+// Description:
+// - This function hands the oldest acquired tokens back to the lexer. Their literal values
+//   may be overwritten afterwards.
+// Parameters:
+// - ring: The ring.
+// - count: Number of tokens, at most as many as are acquired and not released.
+void slex_ring_release(SlexRing *ring, size_t count);
+
+// Description:
+// - This function stops the lexer thread (even before the end of the stream) and frees
+//   the ring.
+// Parameters:
+// - ring: The ring.
+void slex_ring_close(SlexRing *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef SLEX_RING_IMPLEMENTATION
+
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void slex_ring_pause(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+// Waits until *index moves away from seen or the ring is stopped.
+static void slex_ring_wait(SlexRing *r, size_t *index, size_t seen, int *waiting) {
+  for (int i = 0; i < SLEX_RING_SPINS; i++) {
+    if (__atomic_load_n(index, __ATOMIC_ACQUIRE) != seen || __atomic_load_n(&r->stop, __ATOMIC_ACQUIRE))
+      return;
+    slex_ring_pause();
+  }
+
+  if (r->wait == SLEX_RING_SPIN) {
+    while (__atomic_load_n(index, __ATOMIC_ACQUIRE) == seen && !__atomic_load_n(&r->stop, __ATOMIC_ACQUIRE))
+      sched_yield();
+    return;
+  }
+
+  // The flag is set and the index checked again under the lock, and the other side
+  // signals under the lock: a wake up can't fall between the check and the sleep.
+  pthread_mutex_lock(&r->lock);
+  __atomic_store_n(waiting, 1, __ATOMIC_SEQ_CST);
+  while (__atomic_load_n(index, __ATOMIC_SEQ_CST) == seen && !__atomic_load_n(&r->stop, __ATOMIC_SEQ_CST))
+    pthread_cond_wait(&r->wake, &r->lock);
+  __atomic_store_n(waiting, 0, __ATOMIC_RELAXED);
+  pthread_mutex_unlock(&r->lock);
+}
+
+// Stores the index for the other side and wakes it if it sleeps.
+static void slex_ring_publish(SlexRing *r, size_t *index, size_t value, int *other_waiting) {
+  __atomic_store_n(index, value, __ATOMIC_SEQ_CST);
+  if (__atomic_load_n(other_waiting, __ATOMIC_SEQ_CST)) {
+    pthread_mutex_lock(&r->lock);
+    pthread_cond_broadcast(&r->wake);
+    pthread_mutex_unlock(&r->lock);
+  }
+}
+
+// Lexer thread state between tokens.
+typedef struct {
+  SlexRing *r;
+  size_t head;
+  size_t published;
+  size_t tail;
+  size_t arena_head;
+} SlexRingLexer;
+
+// Publishes the collected tokens and waits for the caller to release some.
+static slex_bool slex_ring_lexer_wait(SlexRingLexer *l) {
+  SlexRing *r = l->r;
+  if (l->published != l->head) {
+    slex_ring_publish(r, &r->head, l->head, &r->caller_waiting);
+    l->published = l->head;
+  }
+  slex_ring_wait(r, &r->tail, l->tail, &r->lexer_waiting);
+  l->tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+  return !__atomic_load_n(&r->stop, __ATOMIC_ACQUIRE);
+}
+
+// Reserves len contiguous bytes of the arena, or returns NULL when the ring is stopped.
+static char *slex_ring_alloc(SlexRingLexer *l, size_t len) {
+  SlexRing *r = l->r;
+  size_t pos = l->arena_head % r->arena_size;
+  // a value doesn't wrap around, the end of the arena is skipped instead
+  size_t skip = pos + len > r->arena_size ? r->arena_size - pos : 0;
+  while (l->arena_head + skip + len - __atomic_load_n(&r->arena_tail, __ATOMIC_ACQUIRE) > r->arena_size) {
+    if (!slex_ring_lexer_wait(l)) return NULL;
+  }
+  l->arena_head += skip;
+  char *p = r->arena + l->arena_head % r->arena_size;
+  l->arena_head += len;
+  return p;
+}
+
+static void *slex_ring_lexer(void *arg) {
+  SlexRingLexer l = {(SlexRing *)arg, 0, 0, 0, 0};
+  SlexRing *r = l.r;
+  SlexContext ctx;
+  // at most half of the arena: it always fits once everything before it is released
+  slex_init_context(&ctx, r->stream_begin, r->stream_end, r->string_store, r->arena_size / 2);
+
+  for (;;) {
+    while (l.head - l.tail > r->token_mask) {
+      l.tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+      if (l.head - l.tail > r->token_mask && !slex_ring_lexer_wait(&l)) return NULL;
+    }
+
+    int ok = SLEX_RING_GET_NEXT_TOKEN(&ctx);
+    SlexRingToken *t = &r->tokens[l.head & r->token_mask];
+    // lexers without SLEX_END_IS_TOKEN end with an error
+    slex_bool end = ok ? ctx.tok_ty == SLEX_TOK_eof
+      : ctx.tok_ty == SLEX_ERR_unknown_tok && ctx.parse_point >= ctx.stream_end;
+    t->str = NULL;
+    t->str_len = 0;
+
+    if (end) {
+      t->tok_ty = SLEX_TOK_eof;
+      t->first_tok_char = ctx.stream_end;
+      t->last_tok_char = ctx.stream_end;
+    } else if (!ok) {
+      t->tok_ty = ctx.tok_ty;
+      t->first_tok_char = ctx.parse_point;
+      t->last_tok_char = ctx.parse_point;
+      if (ctx.parse_point < ctx.stream_end) ctx.parse_point++;
+    } else {
+      t->tok_ty = ctx.tok_ty;
+      t->first_tok_char = ctx.first_tok_char;
+      t->last_tok_char = ctx.last_tok_char;
+      t->parsed_int_lit = ctx.parsed_int_lit;
+      t->parsed_float_lit = ctx.parsed_float_lit;
+      if (ctx.tok_ty == SLEX_TOK_str_lit || ctx.tok_ty == SLEX_TOK_char_lit) {
+        t->str = slex_ring_alloc(&l, ctx.str_len);
+        if (!t->str) return NULL;
+        memcpy(t->str, r->string_store, ctx.str_len);
+        t->str_len = ctx.str_len;
+      }
+    }
+    t->arena_end = l.arena_head;
+    l.head++;
+
+    if (end || l.head - l.published >= SLEX_RING_BATCH) {
+      slex_ring_publish(r, &r->head, l.head, &r->caller_waiting);
+      l.published = l.head;
+      if (end || __atomic_load_n(&r->stop, __ATOMIC_ACQUIRE)) return NULL;
+    }
+  }
+}
+
+int slex_ring_open(SlexRing *r, char *stream_start, char *stream_end, size_t token_cap, size_t arena_size, SlexRingWait wait) {
+  memset(r, 0, sizeof(*r));
+
+  size_t cap = 2;
+  while (cap < token_cap) cap *= 2;
+  r->token_mask = cap - 1;
+  r->arena_size = arena_size ? arena_size : 1;
+  r->stream_begin = stream_start;
+  r->stream_end = stream_end;
+  r->wait = wait;
+
+  r->tokens = (SlexRingToken *)malloc(cap * sizeof(SlexRingToken));
+  r->arena = (char *)malloc(r->arena_size);
+  r->string_store = (char *)malloc(r->arena_size / 2 + 1);
+  if (!r->tokens || !r->arena || !r->string_store) {
+    free(r->tokens);
+    free(r->arena);
+    free(r->string_store);
+    return 0;
+  }
+
+  pthread_mutex_init(&r->lock, NULL);
+  pthread_cond_init(&r->wake, NULL);
+  if (pthread_create(&r->lexer, NULL, slex_ring_lexer, r) != 0) {
+    pthread_mutex_destroy(&r->lock);
+    pthread_cond_destroy(&r->wake);
+    free(r->tokens);
+    free(r->arena);
+    free(r->string_store);
+    return 0;
+  }
+  return 1;
+}
+
+size_t slex_ring_acquire(SlexRing *r, SlexRingToken **tokens) {
+  if (r->done) return 0;
+
+  if (r->head_seen == r->acquired) {
+    r->head_seen = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+    while (r->head_seen == r->acquired) {
+      slex_ring_wait(r, &r->head, r->acquired, &r->caller_waiting);
+      r->head_seen = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+    }
+  }
+
+  // up to the end of the ring, the rest comes with the next call
+  size_t start = r->acquired & r->token_mask;
+  size_t count = r->head_seen - r->acquired;
+  if (count > r->token_mask + 1 - start) count = r->token_mask + 1 - start;
+
+  *tokens = &r->tokens[start];
+  r->acquired += count;
+  r->done = (*tokens)[count - 1].tok_ty == SLEX_TOK_eof;
+  return count;
+}
+
+void slex_ring_release(SlexRing *r, size_t count) {
+  if (!count) return;
+  size_t tail = r->tail + count;
+  __atomic_store_n(&r->arena_tail, r->tokens[(tail - 1) & r->token_mask].arena_end, __ATOMIC_RELEASE);
+  slex_ring_publish(r, &r->tail, tail, &r->lexer_waiting);
+}
+
+void slex_ring_close(SlexRing *r) {
+  pthread_mutex_lock(&r->lock);
+  __atomic_store_n(&r->stop, 1, __ATOMIC_SEQ_CST);
+  pthread_cond_broadcast(&r->wake);
+  pthread_mutex_unlock(&r->lock);
+  pthread_join(r->lexer, NULL);
+
+  pthread_mutex_destroy(&r->lock);
+  pthread_cond_destroy(&r->wake);
+  free(r->tokens);
+  free(r->arena);
+  free(r->string_store);
+}
+
+#endif // SLEX_RING_IMPLEMENTATION
+#endif // SLEX_RING_H
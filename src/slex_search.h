@@ -0,0 +1,530 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2024 Viliam Holly
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+// Token-aware identifier search (POSIX, pthreads).
+//
+// slex_search_next finds the uses of an identifier in a buffer without lexing it. A SIMD
+// substring search looks for the first and the last byte of the name at once and proposes
+// candidates. The bytes around a candidate rule out longer identifiers, and comments and
+// literals are tracked by skipping only over them from one candidate to the next, so the
+// text in between is looked at once. A candidate that might be part of a number (1.e5, 0x1f)
+// is decided by lexing the few bytes before it, and so is one next to UTF-8, which may be
+// part of the identifier. The results are exactly the identifier
+// tokens slex_get_next_token returns with that name, recovering from errors by skipping a
+// character (with a string store no literal overflows).
+//
+// slex_search_files runs the search over many files on a pool of threads, each file mapped
+// with slex_map_file.
+//
+// Define SLEX_SEARCH_IMPLEMENTATION in one translation unit, and SLEX_PIPELINE_IMPLEMENTATION
+// in one (for slex_map_file). The lexer itself comes from slex.h (the default instance
+// unless SLEX_SEARCH_GET_NEXT_TOKEN names another one); it must not skip preprocessor lines
+// or emit trivia.
+
+#ifndef SLEX_SEARCH_H
+#define SLEX_SEARCH_H
+
+#include <stddef.h>
+#include "slex.h"
+#include "slex_pipeline.h"
+
+#ifndef SLEX_SEARCH_GET_NEXT_TOKEN
+#define SLEX_SEARCH_GET_NEXT_TOKEN slex_get_next_token
+#endif
+
+typedef struct {
+  char *stream_begin;
+  char *stream_end;
+  const char *name;
+  size_t name_len;
+  // where the substring search goes on
+  char *parse_point;
+  // comments and literals are known up to here, and it is not inside one
+  char *scanned;
+  // a token boundary at or before scanned: the end of the last comment or literal
+  char *boundary;
+  // the token boundary the last relex stopped at, where the next one goes on
+  char *relexed;
+  // the name has UTF-8 in it, every hit is confirmed by lexing it
+  slex_bool lex_hits;
+} SlexSearch;
+
+// A use of the name in a file searched by slex_search_files.
+typedef struct {
+  size_t offset;
+  size_t line_num;
+  size_t col_num;
+} SlexSearchHit;
+
+typedef struct {
+  SlexSearchHit *hits; // in file order, free with slex_search_free
+  size_t hit_count;
+  int error;           // errno if the file couldn't be mapped or the hits didn't fit in memory
+} SlexSearchResult;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Description:
+// - This function initializes a search for the identifier tokens spelled name.
+// Parameters:
+// - search: The struct to be initialized.
+// - stream_begin: Pointer to the beginning of the input.
+// - stream_end: Pointer to the end of the input.
+// - name: The identifier. A name that isn't an identifier is never found.
+// - name_len: Length of name.
+void slex_search_init(SlexSearch *search, char *stream_begin, char *stream_end, const char *name, size_t name_len);
+
+// Description:
+// - This function finds the next use of the name.
+// Parameters:
+// - search: The search.
+// Returns:
+// - Returns a pointer to the first character of the token; NULL at the end of the input.
+char *slex_search_next(SlexSearch *search);
+
+// Description:
+// - This function searches every file for the name, thread_count files at a time. The
+//   calling thread is one of the workers, so the search finishes even when no thread can
+//   be started.
+// Parameters:
+// - paths: The files.
+// - path_count: Number of files.
+// - name: The identifier.
+// - name_len: Length of name.
+// - thread_count: Number of threads, 0 for one per online CPU.
+// - results: Output with room for path_count results, results[i] for paths[i].
+void slex_search_files(const char *const *paths, size_t path_count, const char *name, size_t name_len, size_t thread_count, SlexSearchResult *results);
+
+// Description:
+// - This function frees the hits of results filled by slex_search_files.
+// Parameters:
+// - results: The results.
+// - count: Number of results.
+void slex_search_free(SlexSearchResult *results, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef SLEX_SEARCH_IMPLEMENTATION
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SLEX_SEARCH_X86 1
+#include <immintrin.h>
+#else
+#define SLEX_SEARCH_X86 0
+#endif
+
+static inline slex_bool slex_search_is_ident(char c) {
+  return (unsigned char)((c | 0x20) - 'a') <= 'z' - 'a' || (unsigned char)(c - '0') <= 9 || c == '_';
+}
+
+// Characters a number can span besides identifier characters (1.5, 1e+9), and UTF-8, which
+// may belong to an identifier or to an error.
+static inline slex_bool slex_search_in_number(char c) {
+  return slex_search_is_ident(c) || c == '.' || c == '+' || c == '-' || (unsigned char)c >= 0x80;
+}
+
+static inline size_t slex_search_lowest_bit(unsigned bits) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (size_t)__builtin_ctz(bits);
+#else
+  size_t bit = 0;
+  while (!(bits & 1)) {
+    bits >>= 1;
+    bit++;
+  }
+  return bit;
+#endif
+}
+
+// Whether the name is at p, once its first and last byte are known to match.
+static inline slex_bool slex_search_middle(const char *p, const char *name, size_t len) {
+  return len <= 2 || memcmp(p + 1, name + 1, len - 2) == 0;
+}
+
+// The first occurrence of the name in [p, end), or end.
+static char *slex_search_find_portable(char *p, char *end, const char *name, size_t len) {
+  char last = name[len - 1];
+
+  while ((size_t)(end - p) >= len) {
+    p = (char *)memchr(p, name[0], (size_t)(end - p) - len + 1);
+    if (!p) break;
+    if (p[len - 1] == last && slex_search_middle(p, name, len)) return p;
+    p++;
+  }
+  return end;
+}
+
+#if SLEX_SEARCH_X86
+
+// 16 positions at a time: a bit is set where the first byte of the name starts and its last
+// byte ends (the generic SIMD substring search), then the middle is compared.
+static char *slex_search_find_sse2(char *p, char *end, const char *name, size_t len) {
+  __m128i first = _mm_set1_epi8(name[0]);
+  __m128i last = _mm_set1_epi8(name[len - 1]);
+
+  while ((size_t)(end - p) >= len - 1 + 16) {
+    __m128i a = _mm_loadu_si128((const __m128i *)p);
+    __m128i b = _mm_loadu_si128((const __m128i *)(p + len - 1));
+    unsigned bits = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+    while (bits) {
+      size_t i = slex_search_lowest_bit(bits);
+      if (slex_search_middle(p + i, name, len)) return p + i;
+      bits &= bits - 1;
+    }
+    p += 16;
+  }
+  return slex_search_find_portable(p, end, name, len);
+}
+
+__attribute__((target("avx2")))
+static char *slex_search_find_avx2(char *p, char *end, const char *name, size_t len) {
+  __m256i first = _mm256_set1_epi8(name[0]);
+  __m256i last = _mm256_set1_epi8(name[len - 1]);
+
+  while ((size_t)(end - p) >= len - 1 + 32) {
+    __m256i a = _mm256_loadu_si256((const __m256i *)p);
+    __m256i b = _mm256_loadu_si256((const __m256i *)(p + len - 1));
+    unsigned bits = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+    while (bits) {
+      size_t i = slex_search_lowest_bit(bits);
+      if (slex_search_middle(p + i, name, len)) return p + i;
+      bits &= bits - 1;
+    }
+    p += 32;
+  }
+  return slex_search_find_sse2(p, end, name, len);
+}
+
+#endif // SLEX_SEARCH_X86
+
+static inline char *slex_search_find(char *p, char *end, const char *name, size_t len) {
+#if SLEX_SEARCH_X86
+  if (__builtin_cpu_supports("avx2"))
+    return slex_search_find_avx2(p, end, name, len);
+  return slex_search_find_sse2(p, end, name, len);
+#else
+  return slex_search_find_portable(p, end, name, len);
+#endif
+}
+
+// The first character in [p, end) that can start a comment or a literal, or end.
+static char *slex_search_find_special(char *p, char *end) {
+#if SLEX_SEARCH_X86
+  while (end - p >= 16) {
+    __m128i c = _mm_loadu_si128((const __m128i *)p);
+    __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('/')),
+      _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('"')), _mm_cmpeq_epi8(c, _mm_set1_epi8('\''))));
+    unsigned bits = (unsigned)_mm_movemask_epi8(hit);
+    if (bits) return p + slex_search_lowest_bit(bits);
+    p += 16;
+  }
+#endif
+  while (p < end && *p != '/' && *p != '"' && *p != '\'') p++;
+  return p;
+}
+
+static inline slex_bool slex_search_is_hex(char c) {
+  return (unsigned char)((c | 0x20) - 'a') <= 'f' - 'a' || (unsigned char)(c - '0') <= 9;
+}
+
+// Delimits the escape sequence at p (the \) like the lexer's parser does. Returns the end of
+// it, or with ok cleared where the lexer reports the error.
+static char *slex_search_escape(char *p, char *end, slex_bool *ok) {
+  *ok = 0;
+  p++;
+  if (p >= end) return end;
+
+  if (*p >= '0' && *p <= '7') {
+    for (int i = 0; i < 3 && p < end && *p >= '0' && *p <= '7'; i++) p++;
+  }
+  else if (*p == 'x') {
+    if (end - p < 3 || !slex_search_is_hex(p[1])) return p + 1;
+    if (!slex_search_is_hex(p[2])) return p + 2;
+    p += 3;
+  }
+  else if (*p == 'u' || *p == 'U') {
+    int len = *p == 'u' ? 4 : 8;
+    unsigned long long codepoint = 0;
+    p++;
+    for (int i = 0; i < len; i++, p++) {
+      if (p >= end || !slex_search_is_hex(*p)) return p;
+      codepoint = codepoint * 16 + (unsigned)(*p <= '9' ? *p - '0' : (*p | 0x20) - 'a' + 10);
+    }
+    // not encodable
+    if (codepoint > 0x10FFFF) return p;
+  }
+  else {
+    if (!strchr("abfnrtv\\'\"?", *p) || *p == '\0') return p;
+    p++;
+  }
+  *ok = 1;
+  return p;
+}
+
+// Whether a token (or an error) starts at p when the character before it could belong to a
+// number, which may swallow p (1.e5, 0x1f, or the " an error stops at in 1e"). The run of
+// such characters starts at a token boundary, so lexing it tells. The lexing goes on from
+// where the last one stopped when that is in the run, so a long run (x+x+x...) is lexed once.
+static slex_bool slex_search_relex(SlexSearch *search, char *p) {
+  if (search->relexed >= p) return search->relexed == p;
+
+  char *floor = search->boundary > search->relexed ? search->boundary : search->relexed;
+  char *q = p - 1;
+  while (q > floor && slex_search_in_number(q[-1])) q--;
+
+  SlexContext ctx;
+  slex_init_context(&ctx, q, search->stream_end, NULL, 0);
+  for (;;) {
+    if (ctx.parse_point >= p) {
+      search->relexed = ctx.parse_point;
+      return ctx.parse_point == p;
+    }
+    if (!SLEX_SEARCH_GET_NEXT_TOKEN(&ctx)) {
+      // the usual recovery, skip a character
+      if (ctx.parse_point >= p) {
+        search->relexed = ctx.parse_point + 1;
+        return 0;
+      }
+      ctx.parse_point++;
+    }
+  }
+}
+
+// Whether the token at p is an identifier spelled like the name.
+static slex_bool slex_search_lex_hit(const SlexSearch *search, char *p) {
+  SlexContext ctx;
+  slex_init_context(&ctx, p, search->stream_end, NULL, 0);
+  return SLEX_SEARCH_GET_NEXT_TOKEN(&ctx) && ctx.tok_ty == SLEX_TOK_identifier &&
+    ctx.last_tok_char == p + search->name_len - 1;
+}
+
+// Skips from search->scanned to target over comments and literals, like slex_skip and the
+// literal parser do. Returns 1 if target is outside of them; otherwise returns 0 and
+// search->scanned is the end of the comment or literal that covers target.
+static slex_bool slex_search_reach(SlexSearch *search, char *target) {
+  char *p = search->scanned;
+  char *end = search->stream_end;
+
+  for (;;) {
+    p = slex_search_find_special(p, target);
+    if (p >= target) {
+      search->scanned = target;
+      return 1;
+    }
+    if (p > search->boundary && slex_search_in_number(p[-1]) && !slex_search_relex(search, p)) {
+      p++;
+      continue;
+    }
+    if (*p == '/') {
+      if (p + 1 < end && p[1] == '/') {
+        // the comment ends before the \n
+        char *nl = (char *)memchr(p + 2, '\n', (size_t)(end - p - 2));
+        p = nl ? nl : end;
+      }
+      else if (p + 1 < end && p[1] == '*') {
+        // an unterminated comment runs to the end
+        char *close = p + 2;
+        for (;;) {
+          close = (char *)memchr(close, '*', (size_t)(end - close));
+          if (!close || close + 1 >= end) {
+            p = end;
+            break;
+          }
+          if (close[1] == '/') {
+            p = close + 2;
+            break;
+          }
+          close++;
+        }
+      }
+      else {
+        p++;
+        continue;
+      }
+    }
+    else {
+      // string or character literal; an unterminated one runs to the end, and after an
+      // invalid escape sequence the lexer goes on right behind the error
+      char delim = *p;
+      for (p++; p < end && *p != delim;) {
+        if (*p != '\\') {
+          p++;
+          continue;
+        }
+        slex_bool ok;
+        p = slex_search_escape(p, end, &ok);
+        if (!ok) break;
+      }
+      p = p < end ? p + 1 : end;
+    }
+    search->boundary = p;
+    if (p > target) {
+      search->scanned = p;
+      return 0;
+    }
+  }
+}
+
+void slex_search_init(SlexSearch *search, char *stream_begin, char *stream_end, const char *name, size_t name_len) {
+  search->stream_begin = stream_begin;
+  search->stream_end = stream_end;
+  search->name = name;
+  search->name_len = name_len;
+  search->parse_point = stream_begin;
+  search->scanned = stream_begin;
+  search->boundary = stream_begin;
+  search->relexed = stream_begin;
+  search->lex_hits = 0;
+
+  // non-ASCII characters are checked by the lexer
+  slex_bool valid = name_len > 0 && !(name[0] >= '0' && name[0] <= '9');
+  for (size_t i = 0; i < name_len && valid; i++) {
+    if ((unsigned char)name[i] >= 0x80) search->lex_hits = 1;
+    else valid = slex_search_is_ident(name[i]);
+  }
+  if (!valid) search->parse_point = stream_end;
+}
+
+char *slex_search_next(SlexSearch *search) {
+  char *end = search->stream_end;
+  size_t len = search->name_len;
+
+  while (search->parse_point < end) {
+    char *p = slex_search_find(search->parse_point, end, search->name, len);
+    if (p >= end) break;
+    search->parse_point = p + 1;
+
+    if (p + len < end && slex_search_is_ident(p[len])) continue;
+    if (p < search->scanned) continue; // inside the comment or literal found last time
+    if (!slex_search_reach(search, p)) continue;
+    if (p > search->boundary && slex_search_in_number(p[-1]) && !slex_search_relex(search, p)) continue;
+    // the identifier may go on with UTF-8
+    if ((search->lex_hits || (p + len < end && (unsigned char)p[len] >= 0x80)) && !slex_search_lex_hit(search, p))
+      continue;
+
+    search->parse_point = p + len;
+    return p;
+  }
+  search->parse_point = end;
+  return NULL;
+}
+
+typedef struct {
+  const char *const *paths;
+  size_t path_count;
+  const char *name;
+  size_t name_len;
+  SlexSearchResult *results;
+  size_t next;
+} SlexSearchJob;
+
+static void slex_search_file(SlexSearchJob *job, size_t i) {
+  SlexSearchResult *r = &job->results[i];
+  r->hits = NULL;
+  r->hit_count = 0;
+  r->error = 0;
+
+  size_t len;
+  char *text = slex_map_file(job->paths[i], &len);
+  if (!text) {
+    r->error = errno;
+    return;
+  }
+
+  SlexSearch search;
+  SlexLocation loc;
+  size_t cap = 0;
+  char *p;
+  slex_search_init(&search, text, text + len, job->name, job->name_len);
+  slex_init_location(&loc, text);
+  while ((p = slex_search_next(&search))) {
+    if (r->hit_count == cap) {
+      size_t new_cap = cap ? cap * 2 : 16;
+      SlexSearchHit *hits = (SlexSearchHit *)realloc(r->hits, new_cap * sizeof(SlexSearchHit));
+      if (!hits) {
+        r->error = ENOMEM;
+        break;
+      }
+      r->hits = hits;
+      cap = new_cap;
+    }
+    SlexSearchHit *hit = &r->hits[r->hit_count++];
+    hit->offset = (size_t)(p - text);
+    slex_get_location(&loc, p, &hit->line_num, &hit->col_num);
+  }
+  slex_unmap_file(text, len);
+}
+
+static void *slex_search_worker(void *arg) {
+  SlexSearchJob *job = (SlexSearchJob *)arg;
+
+  for (;;) {
+    size_t i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+    if (i >= job->path_count) break;
+    slex_search_file(job, i);
+  }
+  return NULL;
+}
+
+void slex_search_files(const char *const *paths, size_t path_count, const char *name, size_t name_len, size_t thread_count, SlexSearchResult *results) {
+  SlexSearchJob job = {paths, path_count, name, name_len, results, 0};
+
+  if (thread_count == 0) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    thread_count = cpus > 0 ? (size_t)cpus : 1;
+  }
+  if (thread_count > path_count) thread_count = path_count;
+
+  // without memory for the handles the caller searches alone
+  size_t started = 0;
+  pthread_t *threads = thread_count > 1 ? (pthread_t *)malloc((thread_count - 1) * sizeof(pthread_t)) : NULL;
+  if (threads) {
+    while (started < thread_count - 1 && pthread_create(&threads[started], NULL, slex_search_worker, &job) == 0)
+      started++;
+  }
+  slex_search_worker(&job);
+  for (size_t i = 0; i < started; i++) pthread_join(threads[i], NULL);
+  free(threads);
+}
+
+void slex_search_free(SlexSearchResult *results, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    free(results[i].hits);
+    results[i].hits = NULL;
+    results[i].hit_count = 0;
+  }
+}
+
+#endif // SLEX_SEARCH_IMPLEMENTATION
+#endif // SLEX_SEARCH_H
@@ -0,0 +1,1006 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2024 Viliam Holly
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+// Two stage lexing of a whole buffer.
+//
+// Stage 1 (slex_simd_index) classifies the input 64 bytes at a time with SIMD: whitespace,
+// identifier characters and the bytes that open or close comments and literals (" ' / \ *
+// and the newline). A scalar pass over only those few positions then resolves where the
+// comments and literals are, the way the lexer skips and delimits them, so the index ends
+// up with three bitmaps: the bytes a token can start at (not whitespace, not in a comment,
+// not inside a literal), the identifier characters, and the closing quote and escape
+// sequences of each literal.
+// Stage 2 (slex_simd_tokenize, or slex_simd_next_token for one token at a time) walks those
+// bits and lexes the tokens itself: the next token is the next start bit, so blank space
+// and comments cost nothing, identifiers are delimited by the identifier bitmap, literals
+// are copied up to their closing quote with only the escape sequences decoded, and numbers
+// and punctuators are converted and resolved in place. The regular lexer only runs for
+// errors and rare forms (octal and binary numbers, numbers too long to be sure they don't
+// overflow, non-ASCII text). The tokens and values are exactly those of slex_get_next_token
+// in the default configuration.
+//
+// Stage 1 picks AVX-512BW, AVX2 or SSE2 at runtime on x86-64 (GCC and Clang) and falls
+// back to portable code elsewhere.
+//
+// slex_simd_validate_utf8 is an optional pre-pass that checks the input is UTF-8, which
+// the lexer accepts in identifiers (see slex_get_next_token).
+//
+// Define SLEX_SIMD_IMPLEMENTATION in one translation unit, together with SLEX_IMPLEMENTATION.
+// The lexer for the rest is an instance of slex.h of its own (slex_simd_lexer_), configured
+// like the default one whatever the program's default instance uses.
+
+#ifndef SLEX_SIMD_H
+#define SLEX_SIMD_H
+
+#include <stddef.h>
+#include "slex.h"
+
+// Number of 64 bit words in the index of len bytes: three bitmaps per 64 bytes.
+#define SLEX_SIMD_INDEX_WORDS(len) (((len) + 63) / 64 * 3)
+
+// Where stage 2 is in the index: a block and its token starts from parse_point on.
+typedef struct {
+  size_t block;
+  slex_u64 pending;
+} SlexSimdCursor;
+
+typedef struct {
+  // The lexer state. After slex_simd_next_token it holds the token like after
+  // slex_get_next_token.
+  SlexContext ctx;
+
+  char *stream_begin;
+  const slex_u64 *index;
+  size_t index_blocks;
+  // Where stage 2 left parse_point and whether that was at an error. While synced, the
+  // comments and literals of the index are those the lexer sees. An error in a literal or
+  // a parse_point moved elsewhere ends that, and the regular lexer goes on until it starts
+  // a token where the index has one.
+  char *left_at;
+  slex_bool failed;
+  slex_bool synced;
+  SlexSimdCursor cursor;
+} SlexSimd;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Description:
+// - This function runs stage 1. For byte i of the input, bit i % 64 of index[i / 64 * 3] is
+//   set if a token can start there: it isn't whitespace, part of a comment or inside a
+//   string or character literal (the opening quote is set, the rest of the literal isn't).
+//   The same bit of index[i / 64 * 3 + 1] is set if it is an identifier character, and of
+//   index[i / 64 * 3 + 2] if it is the closing quote of a literal or the backslash of an
+//   escape sequence in one. All other bits are cleared.
+// Parameters:
+// - stream_begin: Pointer to the beginning of the input.
+// - len: Length of the input.
+// - index: Output with room for SLEX_SIMD_INDEX_WORDS(len) words.
+void slex_simd_index(const char *stream_begin, size_t len, slex_u64 *index);
+
+// Description:
+// - This function initializes the stage 2 lexer.
+// Parameters:
+// - simd: The lexer to be initialized.
+// - stream_begin: Pointer to the beginning of the input.
+// - stream_end: Pointer to the end of the input.
+// - index: The index of the input built by slex_simd_index. It is only read.
+// - string_store: Pointer to the storage used for parsing strings.
+// - string_store_len: Specifies the length of string_store.
+void slex_simd_init(SlexSimd *simd, char *stream_begin, char *stream_end, const slex_u64 *index, char *string_store, size_t string_store_len);
+
+// Description:
+// - This function parses the next token into simd->ctx, like slex_get_next_token. Errors
+//   are reported the same way; recover by skipping a character (simd->ctx.parse_point++).
+// Parameters:
+// - simd: The lexer.
+// Returns:
+// - Returns 1 if a token was parsed successfully; otherwise, returns 0.
+int slex_simd_next_token(SlexSimd *simd);
+
+// Description:
+// - This function lexes tokens into tokens until the stream ends, an error occurs or
+//   token_cap tokens were written. The end of the stream is not stored as a token.
+// Parameters:
+// - simd: The lexer.
+// - tokens: Output buffer for the tokens.
+// - token_cap: Capacity of tokens.
+// - token_count: Output pointer for the number of tokens written.
+// Returns:
+// - Returns 1 at the end of the stream. Returns 0 when tokens is full (simd->ctx.tok_ty is
+//   SLEX_ERR_would_block; call it again to continue) or on an error, which is in simd->ctx
+//   like after slex_simd_next_token.
+int slex_simd_tokenize(SlexSimd *simd, SlexToken *tokens, size_t token_cap, size_t *token_count);
+
+// Description:
+// - This function checks that the input is valid UTF-8, 32 bytes at a time with AVX2 where
+//   available. Overlong forms, surrogates, code points above U+10FFFF, stray continuation
+//   bytes and a sequence cut off by the end are invalid. Run it before lexing to reject
+//   input that isn't UTF-8 up front; ASCII input costs little more than reading it.
+// Parameters:
+// - text: Pointer to the input.
+// - len: Length of the input.
+// Returns:
+// - Returns the offset of the first byte of the first invalid sequence, or len if the
+//   whole input is valid.
+size_t slex_simd_validate_utf8(const char *text, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef SLEX_SIMD_IMPLEMENTATION
+
+#ifndef SLEX_IMPLEMENTATION
+#error "slex_simd.h: SLEX_SIMD_IMPLEMENTATION needs SLEX_IMPLEMENTATION in the same translation unit"
+#endif
+
+// Stage 2 lexes the tokens of the default configuration itself, so the lexer it leaves the
+// rest to is configured the same.
+#define SLEX_PREFIX slex_simd_lexer_
+#define SLEX_END_IS_TOKEN 1
+#define SLEX_CXX_SUPPORT 1
+#define SLEX_INT_SUFFIXES 1
+#include "slex.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SLEX_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define SLEX_SIMD_X86 0
+#endif
+
+// The classes of the bytes of a 64 byte block, bit i for byte i.
+typedef struct {
+  slex_u64 ws;
+  slex_u64 ident;
+  slex_u64 quote;
+  slex_u64 apostrophe;
+  slex_u64 slash;
+  slex_u64 backslash;
+  slex_u64 star;
+  slex_u64 newline;
+} SlexSimdBlock;
+
+// What the region pass is in at pos, which may be past the block an escape sequence or a
+// */ ended in.
+enum {
+  SLEX_SIMD_CODE,
+  SLEX_SIMD_LINE_COMMENT,
+  SLEX_SIMD_BLOCK_COMMENT,
+  SLEX_SIMD_LITERAL
+};
+
+typedef struct {
+  int state;
+  char delim;
+  size_t pos;
+  size_t region; // where the comment or the inside of the literal starts
+} SlexSimdRegions;
+
+// Bits from to to - 1 of a block, either of them may be past it.
+static inline slex_u64 slex_simd_span(size_t from, size_t to) {
+  slex_u64 below_to = to >= 64 ? ~(slex_u64)0 : ((slex_u64)1 << to) - 1;
+  slex_u64 below_from = from >= 64 ? ~(slex_u64)0 : ((slex_u64)1 << from) - 1;
+  return below_to & ~below_from;
+}
+
+static inline size_t slex_simd_lowest_bit(slex_u64 bits) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (size_t)__builtin_ctzll(bits);
+#else
+  size_t bit = 0;
+  while (!(bits & 1)) {
+    bits >>= 1;
+    bit++;
+  }
+  return bit;
+#endif
+}
+
+// Resolves the comments and literals of the block at base, carrying the state on to the
+// next block, and returns the bits they cover: the whole comment, and the inside and the
+// closing quote of a literal. The closing quotes and the backslashes of escape sequences
+// are added to *ends. It mirrors slex_skip and the literal parser for input the lexer
+// accepts; where the lexer fails in a literal stage 2 stops relying on it.
+static inline slex_u64 slex_simd_regions(SlexSimdRegions *r, const SlexSimdBlock *b, const char *text, size_t len, size_t base, slex_u64 *ends) {
+  // the / of a */ split by the blocks
+  slex_u64 covered = r->state == SLEX_SIMD_CODE && r->pos > base ? slex_simd_span(0, r->pos - base) : 0;
+
+  for (;;) {
+    size_t at = r->pos > base ? r->pos - base : 0;
+    size_t region = r->region > base ? r->region - base : 0;
+    slex_u64 bits;
+
+    switch (r->state) {
+      case SLEX_SIMD_CODE:
+        bits = (b->quote | b->apostrophe | b->slash) & slex_simd_span(at, 64);
+        if (!bits) return covered;
+        at = slex_simd_lowest_bit(bits);
+        r->pos = base + at + 1;
+        if (text[base + at] != '/') {
+          r->state = SLEX_SIMD_LITERAL;
+          r->delim = text[base + at];
+          r->region = base + at + 1;
+        } else if (base + at + 1 < len && (text[base + at + 1] == '/' || text[base + at + 1] == '*')) {
+          r->state = text[base + at + 1] == '/' ? SLEX_SIMD_LINE_COMMENT : SLEX_SIMD_BLOCK_COMMENT;
+          r->region = base + at;
+          r->pos = base + at + 2;
+        }
+        continue;
+      case SLEX_SIMD_LINE_COMMENT:
+        bits = b->newline & slex_simd_span(at, 64);
+        if (!bits) return covered | slex_simd_span(region, 64);
+        at = slex_simd_lowest_bit(bits);
+        covered |= slex_simd_span(region, at);
+        r->state = SLEX_SIMD_CODE;
+        r->pos = base + at + 1;
+        continue;
+      case SLEX_SIMD_BLOCK_COMMENT:
+        bits = b->star & slex_simd_span(at, 64);
+        while (bits) {
+          at = slex_simd_lowest_bit(bits);
+          if (base + at + 1 < len && text[base + at + 1] == '/') break;
+          bits &= bits - 1;
+        }
+        if (!bits) return covered | slex_simd_span(region, 64);
+        covered |= slex_simd_span(region, at + 2);
+        r->state = SLEX_SIMD_CODE;
+        r->pos = base + at + 2;
+        continue;
+      default:
+        // an escape sequence is skipped as the backslash and the byte after it, which is
+        // all that can hide a quote
+        bits = ((r->delim == '"' ? b->quote : b->apostrophe) | b->backslash) & slex_simd_span(at, 64);
+        if (!bits) return covered | slex_simd_span(region, 64);
+        at = slex_simd_lowest_bit(bits);
+        *ends |= (slex_u64)1 << at;
+        if (text[base + at] == '\\') {
+          r->pos = base + at + 2;
+          continue;
+        }
+        covered |= slex_simd_span(region, at + 1);
+        r->state = SLEX_SIMD_CODE;
+        r->pos = base + at + 1;
+        continue;
+    }
+  }
+}
+
+// Writes the index words of a classified block.
+static inline void slex_simd_emit(SlexSimdRegions *r, const SlexSimdBlock *b, const char *text, size_t len, size_t base, slex_u64 *index) {
+  slex_u64 ends = 0;
+  index[base / 64 * 3] = ~b->ws & ~slex_simd_regions(r, b, text, len, base, &ends);
+  index[base / 64 * 3 + 1] = b->ident;
+  index[base / 64 * 3 + 2] = ends;
+}
+
+// The last block is padded with spaces, which are neither tokens nor special.
+static inline const char *slex_simd_tail(const char *p, size_t len, char *block) {
+  memset(block, ' ', 64);
+  memcpy(block, p, len);
+  return block;
+}
+
+static inline slex_bool slex_simd_is_whitespace(char c) {
+  return c == ' ' || (unsigned char)(c - '\t') <= '\r' - '\t';
+}
+
+static inline slex_bool slex_simd_is_ident(char c) {
+  return (unsigned char)((c | 0x20) - 'a') <= 'z' - 'a' || (unsigned char)(c - '0') <= 9 || c == '_';
+}
+
+static inline void slex_simd_index_portable(const char *p, size_t len, slex_u64 *index) {
+  SlexSimdRegions r = {SLEX_SIMD_CODE, 0, 0, 0};
+  char block[64];
+
+  for (size_t i = 0; i < len; i += 64) {
+    const char *c = len - i >= 64 ? p + i : slex_simd_tail(p + i, len - i, block);
+    SlexSimdBlock b = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (int j = 0; j < 64; j++) {
+      slex_u64 bit = (slex_u64)1 << j;
+      if (slex_simd_is_whitespace(c[j])) b.ws |= bit;
+      if (slex_simd_is_ident(c[j])) b.ident |= bit;
+      if (c[j] == '"') b.quote |= bit;
+      if (c[j] == '\'') b.apostrophe |= bit;
+      if (c[j] == '/') b.slash |= bit;
+      if (c[j] == '\\') b.backslash |= bit;
+      if (c[j] == '*') b.star |= bit;
+      if (c[j] == '\n') b.newline |= bit;
+    }
+    slex_simd_emit(&r, &b, p, len, i, index);
+  }
+}
+
+#if SLEX_SIMD_X86
+
+// Bytes with c - lo <= hi - lo as unsigned bytes.
+static inline __m128i slex_simd_range16(__m128i c, char lo, char hi) {
+  __m128i t = _mm_sub_epi8(c, _mm_set1_epi8(lo));
+  return _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8((char)(hi - lo))), t);
+}
+
+static inline slex_u64 slex_simd_mask16(__m128i m0, __m128i m1, __m128i m2, __m128i m3) {
+  return (slex_u64)(unsigned)_mm_movemask_epi8(m0) | (slex_u64)(unsigned)_mm_movemask_epi8(m1) << 16 |
+    (slex_u64)(unsigned)_mm_movemask_epi8(m2) << 32 | (slex_u64)(unsigned)_mm_movemask_epi8(m3) << 48;
+}
+
+static inline slex_u64 slex_simd_eq16(const __m128i *c, char value) {
+  __m128i v = _mm_set1_epi8(value);
+  return slex_simd_mask16(_mm_cmpeq_epi8(c[0], v), _mm_cmpeq_epi8(c[1], v), _mm_cmpeq_epi8(c[2], v), _mm_cmpeq_epi8(c[3], v));
+}
+
+// Whitespace is ' ' or '\t' to '\r'.
+static inline __m128i slex_simd_ws16(__m128i c) {
+  return _mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8(' ')), slex_simd_range16(c, '\t', '\r'));
+}
+
+// Identifier characters are letters (either case, c | 0x20), digits and '_'.
+static inline __m128i slex_simd_ident16(__m128i c) {
+  return _mm_or_si128(slex_simd_range16(_mm_or_si128(c, _mm_set1_epi8(0x20)), 'a', 'z'),
+    _mm_or_si128(slex_simd_range16(c, '0', '9'), _mm_cmpeq_epi8(c, _mm_set1_epi8('_'))));
+}
+
+static void slex_simd_index_sse2(const char *p, size_t len, slex_u64 *index) {
+  SlexSimdRegions r = {SLEX_SIMD_CODE, 0, 0, 0};
+  char block[64];
+
+  for (size_t i = 0; i < len; i += 64) {
+    const char *b = len - i >= 64 ? p + i : slex_simd_tail(p + i, len - i, block);
+    __m128i c[4];
+    for (int j = 0; j < 4; j++)
+      c[j] = _mm_loadu_si128((const __m128i *)(b + 16 * j));
+    SlexSimdBlock classes;
+    classes.ws = slex_simd_mask16(slex_simd_ws16(c[0]), slex_simd_ws16(c[1]), slex_simd_ws16(c[2]), slex_simd_ws16(c[3]));
+    classes.ident = slex_simd_mask16(slex_simd_ident16(c[0]), slex_simd_ident16(c[1]), slex_simd_ident16(c[2]), slex_simd_ident16(c[3]));
+    classes.quote = slex_simd_eq16(c, '"');
+    classes.apostrophe = slex_simd_eq16(c, '\'');
+    classes.slash = slex_simd_eq16(c, '/');
+    classes.backslash = slex_simd_eq16(c, '\\');
+    classes.star = slex_simd_eq16(c, '*');
+    classes.newline = slex_simd_eq16(c, '\n');
+    slex_simd_emit(&r, &classes, p, len, i, index);
+  }
+}
+
+__attribute__((target("avx2")))
+static inline __m256i slex_simd_range32(__m256i c, char lo, char hi) {
+  __m256i t = _mm256_sub_epi8(c, _mm256_set1_epi8(lo));
+  return _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8((char)(hi - lo))), t);
+}
+
+__attribute__((target("avx2")))
+static inline slex_u64 slex_simd_mask32(__m256i m0, __m256i m1) {
+  return (slex_u64)(unsigned)_mm256_movemask_epi8(m0) | (slex_u64)(unsigned)_mm256_movemask_epi8(m1) << 32;
+}
+
+__attribute__((target("avx2")))
+static inline slex_u64 slex_simd_eq32(__m256i c0, __m256i c1, char value) {
+  __m256i v = _mm256_set1_epi8(value);
+  return slex_simd_mask32(_mm256_cmpeq_epi8(c0, v), _mm256_cmpeq_epi8(c1, v));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i slex_simd_ws32(__m256i c) {
+  return _mm256_or_si256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8(' ')), slex_simd_range32(c, '\t', '\r'));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i slex_simd_ident32(__m256i c) {
+  return _mm256_or_si256(slex_simd_range32(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), 'a', 'z'),
+    _mm256_or_si256(slex_simd_range32(c, '0', '9'), _mm256_cmpeq_epi8(c, _mm256_set1_epi8('_'))));
+}
+
+__attribute__((target("avx2")))
+static void slex_simd_index_avx2(const char *p, size_t len, slex_u64 *index) {
+  SlexSimdRegions r = {SLEX_SIMD_CODE, 0, 0, 0};
+  char block[64];
+
+  for (size_t i = 0; i < len; i += 64) {
+    const char *b = len - i >= 64 ? p + i : slex_simd_tail(p + i, len - i, block);
+    __m256i c0 = _mm256_loadu_si256((const __m256i *)b);
+    __m256i c1 = _mm256_loadu_si256((const __m256i *)(b + 32));
+    SlexSimdBlock classes;
+    classes.ws = slex_simd_mask32(slex_simd_ws32(c0), slex_simd_ws32(c1));
+    classes.ident = slex_simd_mask32(slex_simd_ident32(c0), slex_simd_ident32(c1));
+    classes.quote = slex_simd_eq32(c0, c1, '"');
+    classes.apostrophe = slex_simd_eq32(c0, c1, '\'');
+    classes.slash = slex_simd_eq32(c0, c1, '/');
+    classes.backslash = slex_simd_eq32(c0, c1, '\\');
+    classes.star = slex_simd_eq32(c0, c1, '*');
+    classes.newline = slex_simd_eq32(c0, c1, '\n');
+    slex_simd_emit(&r, &classes, p, len, i, index);
+  }
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void slex_simd_index_avx512(const char *p, size_t len, slex_u64 *index) {
+  SlexSimdRegions r = {SLEX_SIMD_CODE, 0, 0, 0};
+
+  for (size_t i = 0; i < len; i += 64) {
+    // the last block is loaded with a mask, the missing bytes count as whitespace
+    slex_u64 valid = len - i >= 64 ? ~(slex_u64)0 : ((slex_u64)1 << (len - i)) - 1;
+    __m512i c = _mm512_maskz_loadu_epi8(valid, p + i);
+    __m512i lower = _mm512_sub_epi8(_mm512_or_si512(c, _mm512_set1_epi8(0x20)), _mm512_set1_epi8('a'));
+    SlexSimdBlock classes;
+    classes.ws = _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8(' ')) |
+      _mm512_cmple_epu8_mask(_mm512_sub_epi8(c, _mm512_set1_epi8('\t')), _mm512_set1_epi8(4)) | ~valid;
+    classes.ident = (_mm512_cmple_epu8_mask(lower, _mm512_set1_epi8(25)) |
+      _mm512_cmple_epu8_mask(_mm512_sub_epi8(c, _mm512_set1_epi8('0')), _mm512_set1_epi8(9)) |
+      _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8('_'))) & valid;
+    classes.quote = _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8('"'));
+    classes.apostrophe = _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8('\''));
+    classes.slash = _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8('/'));
+    classes.backslash = _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8('\\'));
+    classes.star = _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8('*'));
+    classes.newline = _mm512_cmpeq_epi8_mask(c, _mm512_set1_epi8('\n'));
+    slex_simd_emit(&r, &classes, p, len, i, index);
+  }
+}
+
+#endif // SLEX_SIMD_X86
+
+void slex_simd_index(const char *stream_begin, size_t len, slex_u64 *index) {
+#if SLEX_SIMD_X86
+  if (__builtin_cpu_supports("avx512bw"))
+    slex_simd_index_avx512(stream_begin, len, index);
+  else if (__builtin_cpu_supports("avx2"))
+    slex_simd_index_avx2(stream_begin, len, index);
+  else
+    slex_simd_index_sse2(stream_begin, len, index);
+#else
+  slex_simd_index_portable(stream_begin, len, index);
+#endif
+}
+
+// The first byte at or after p whose bit in the given bitmap (0: starts, 1: identifier
+// characters, 2: literal ends and escapes) equals value, or the end of the input.
+static inline char *slex_simd_find(const SlexSimd *simd, char *p, int bitmap, slex_bool value) {
+  size_t i = (size_t)(p - simd->stream_begin);
+  slex_u64 flip = value ? 0 : ~(slex_u64)0;
+  size_t block = i / 64;
+  if (block >= simd->index_blocks) return simd->ctx.stream_end;
+  slex_u64 bits = (simd->index[block * 3 + bitmap] ^ flip) & (~(slex_u64)0 << (i % 64));
+
+  while (!bits) {
+    if (++block >= simd->index_blocks) return simd->ctx.stream_end;
+    bits = simd->index[block * 3 + bitmap] ^ flip;
+  }
+  char *found = simd->stream_begin + block * 64 + slex_simd_lowest_bit(bits);
+  return found < simd->ctx.stream_end ? found : simd->ctx.stream_end;
+}
+
+static inline slex_bool slex_simd_is_start(const SlexSimd *simd, const char *p) {
+  size_t i = (size_t)(p - simd->stream_begin);
+  return (simd->index[i / 64 * 3] >> (i % 64)) & 1;
+}
+
+// The token starts of a block: its start bits, less those of identifier characters that go
+// on from the byte before, so an identifier has a single one. Comments and literals end in
+// a /, a newline or a quote, so the byte before is part of the same run of code.
+static inline slex_u64 slex_simd_token_starts(const SlexSimd *simd, size_t block) {
+  const slex_u64 *words = simd->index + block * 3;
+  slex_u64 carry = block ? words[-2] >> 63 : 0;
+  return words[0] & ~(words[1] & (words[1] << 1 | carry));
+}
+
+// Moves the token starts on to q, where a token ended or parse_point was set. A number or
+// an error may end in the middle of a run of identifier characters, so q's own start bit
+// counts.
+static inline void slex_simd_skip_to(const SlexSimd *simd, SlexSimdCursor *cur, char *q) {
+  size_t i = (size_t)(q - simd->stream_begin);
+  if (i / 64 >= simd->index_blocks) {
+    cur->block = simd->index_blocks;
+    cur->pending = 0;
+    return;
+  }
+  if (i / 64 != cur->block) {
+    cur->block = i / 64;
+    cur->pending = slex_simd_token_starts(simd, cur->block);
+  }
+  slex_u64 at = (slex_u64)1 << (i % 64);
+  cur->pending = (cur->pending | (simd->index[cur->block * 3] & at)) & ~(at - 1);
+}
+
+// Like slex_simd_skip_to, for a cursor that was somewhere else.
+static inline void slex_simd_seek(const SlexSimd *simd, SlexSimdCursor *cur, char *q) {
+  cur->block = simd->index_blocks;
+  slex_simd_skip_to(simd, cur, q);
+}
+
+void slex_simd_init(SlexSimd *simd, char *stream_begin, char *stream_end, const slex_u64 *index, char *string_store, size_t string_store_len) {
+  slex_init_context(&simd->ctx, stream_begin, stream_end, string_store, string_store_len);
+  simd->stream_begin = stream_begin;
+  simd->index = index;
+  simd->index_blocks = (size_t)(stream_end - stream_begin + 63) / 64;
+  simd->left_at = stream_begin;
+  simd->failed = 0;
+  simd->synced = 1;
+  slex_simd_seek(simd, &simd->cursor, stream_begin);
+}
+
+// The regular lexer at p, which is where the token starts.
+static inline int slex_simd_lex_at(SlexSimd *simd, char *p) {
+  SlexContext *ctx = &simd->ctx;
+  ctx->parse_point = p;
+  int ok = slex_simd_lexer_get_next_token(ctx);
+  // after an error in a literal, or one that leaves a quote or a / to skip, the lexer
+  // goes on where the index doesn't know what is a comment or a literal
+  if (!ok && (*p == '"' || *p == '\'' || (ctx->parse_point < ctx->stream_end &&
+      (*ctx->parse_point == '"' || *ctx->parse_point == '\'' || *ctx->parse_point == '/'))))
+    simd->synced = 0;
+  return ok;
+}
+
+// The regular lexer at p, with the cursor moved past its token while the index still
+// lines up.
+__attribute__((always_inline))
+static inline int slex_simd_fall_back(SlexSimd *simd, SlexSimdCursor *cur, char *p) {
+  int ok = slex_simd_lex_at(simd, p);
+  if (simd->synced)
+    slex_simd_skip_to(simd, cur, simd->ctx.parse_point);
+  return ok;
+}
+
+// The punctuator at p like slex_parse_punctuator with C++ support, its last character in
+// *last. Returns -1 if there is none.
+__attribute__((always_inline))
+static inline int slex_simd_punctuator(char *p, char *end, char **last) {
+  char next = end - p >= 2 ? p[1] : 0;
+  char third = end - p >= 3 ? p[2] : 0;
+  *last = p;
+
+  switch (*p) {
+    case '[': return SLEX_TOK_l_square_paren;
+    case ']': return SLEX_TOK_r_square_paren;
+    case '(': return SLEX_TOK_l_paren;
+    case ')': return SLEX_TOK_r_paren;
+    case '{': return SLEX_TOK_l_brace;
+    case '}': return SLEX_TOK_r_brace;
+    case '~': return SLEX_TOK_bitwise_not;
+    case '?': return SLEX_TOK_questionmark;
+    case ';': return SLEX_TOK_semicolon;
+    case ',': return SLEX_TOK_comma;
+    case '\\': return SLEX_TOK_backslash;
+  }
+  // the rest may go on with a second and a third character
+  *last = p + 1;
+  switch (*p) {
+    case '=': return next == '=' ? SLEX_TOK_equality : (*last = p, SLEX_TOK_assign);
+    case '!': return next == '=' ? SLEX_TOK_not_eq : (*last = p, SLEX_TOK_not);
+    case '*': return next == '=' ? SLEX_TOK_mul_eq : (*last = p, SLEX_TOK_mul);
+    case '%': return next == '=' ? SLEX_TOK_mod_eq : (*last = p, SLEX_TOK_mod);
+    case '^': return next == '=' ? SLEX_TOK_xor_eq : (*last = p, SLEX_TOK_xor);
+    case '/': return next == '=' ? SLEX_TOK_div_eq : (*last = p, SLEX_TOK_div);
+    case '+': return next == '+' ? SLEX_TOK_inc : next == '=' ? SLEX_TOK_plus_eq : (*last = p, SLEX_TOK_plus);
+    case '&': return next == '&' ? SLEX_TOK_and : next == '=' ? SLEX_TOK_bitwise_and_eq : (*last = p, SLEX_TOK_bitwise_and);
+    case '|': return next == '|' ? SLEX_TOK_or : next == '=' ? SLEX_TOK_bitwise_or_eq : (*last = p, SLEX_TOK_bitwise_or);
+    case ':': return next == ':' ? SLEX_TOK_scope_resolution : (*last = p, SLEX_TOK_colon);
+    case '#': return next == '#' ? SLEX_TOK_token_concat : next == '@' ? SLEX_TOK_preprocessor_at : (*last = p, SLEX_TOK_preprocessor);
+    // -> is tried before ->*, so the lexer never gives the latter
+    case '-': return next == '>' ? SLEX_TOK_arrow : next == '-' ? SLEX_TOK_dec : next == '=' ? SLEX_TOK_minus_eq : (*last = p, SLEX_TOK_minus);
+    case '.':
+      if (next == '.' && third == '.') return *last = p + 2, SLEX_TOK_unpack;
+      return next == '*' ? SLEX_TOK_member_access : (*last = p, SLEX_TOK_period);
+    case '<':
+      if (next == '=' && third == '>') return *last = p + 2, SLEX_TOK_spaceship;
+      if (next == '<' && third == '=') return *last = p + 2, SLEX_TOK_shl_eq;
+      return next == '=' ? SLEX_TOK_less_or_eq : next == '<' ? SLEX_TOK_shl : (*last = p, SLEX_TOK_less);
+    case '>':
+      if (next == '>' && third == '=') return *last = p + 2, SLEX_TOK_shr_eq;
+      return next == '=' ? SLEX_TOK_greater_or_eq : next == '>' ? SLEX_TOK_shr : (*last = p, SLEX_TOK_greater);
+  }
+  return -1;
+}
+
+static inline slex_bool slex_simd_is_digit(char c) {
+  return (unsigned char)(c - '0') <= 9;
+}
+
+// The number at p with its value, like slex_parse_int_lit. Returns 0 for the forms left to
+// the lexer: octal and binary numbers, parts long enough that they might overflow and
+// everything it reports an error in.
+static inline slex_bool slex_simd_number(SlexContext *ctx, char *p) {
+  char *end = ctx->stream_end;
+  char *q = p + 1;
+  slex_u64 value = (slex_u64)(*p - '0');
+
+  if (*p != '0') {
+    // up to 19 digits can't overflow
+    while (q < end && slex_simd_is_digit(*q)) value = value * 10 + (slex_u64)(*q++ - '0');
+    if (q - p > 19) return 0;
+  } else if (q < end && (*q == 'x' || *q == 'X')) {
+    q++;
+    if (q >= end) return 0;
+    char *digits = q;
+    while (q < end && slex_is_hex(*q)) value = value * 16 + (slex_u64)slex_hex_to_int(*q++);
+    if (q - digits > 16) return 0;
+  } else if (q < end && (slex_simd_is_digit(*q) || *q == 'b')) {
+    return 0;
+  }
+
+  ctx->tok_ty = SLEX_TOK_int_lit;
+  ctx->parsed_int_lit = value;
+  if (q < end && (*q == '.' || *q == 'e' || *q == 'E')) {
+    // the same operations in the same order as slex_extend_to_float, for the same value
+    double number = (double)value;
+    ctx->tok_ty = SLEX_TOK_float_lit;
+    if (*q == '.') {
+      char *digits = ++q;
+      slex_u64 fraction = 0;
+      double divisor = 1.0;
+      while (q < end && slex_simd_is_digit(*q)) {
+        fraction = fraction * 10 + (slex_u64)(*q++ - '0');
+        divisor *= 10.0;
+      }
+      if (q - digits > 19) return 0;
+      number += fraction / divisor;
+    }
+    if (q < end && (*q == 'e' || *q == 'E')) {
+      int sign = 1;
+      if (++q < end && (*q == '-' || *q == '+')) sign = *q++ == '-' ? -1 : 1;
+      if (q >= end || !slex_simd_is_digit(*q)) return 0;
+      char *digits = q;
+      slex_u64 exponent = 0;
+      while (q < end && slex_simd_is_digit(*q)) exponent = exponent * 10 + (slex_u64)(*q++ - '0');
+      if (q - digits > 9) return 0;
+      double power = slex_pow(10, sign * (int)exponent);
+      if (power == -1) return 0;
+      number *= power;
+    }
+    ctx->parsed_float_lit = number;
+  }
+
+  // the suffix
+  while (q < end && (unsigned char)((*q | 0x20) - 'a') <= 'z' - 'a') q++;
+  ctx->first_tok_char = p;
+  ctx->last_tok_char = q - 1;
+  ctx->parse_point = q;
+  return 1;
+}
+
+// The literal at p, which stage 1 bounded: the runs between its escape sequences are
+// copied (if values are wanted; their length is checked either way) and only the escape
+// sequences are decoded. Returns 0 if the lexer reports an error in it, which is left to
+// the lexer.
+static inline slex_bool slex_simd_literal(SlexSimd *simd, char *p, slex_bool values) {
+  SlexContext *ctx = &simd->ctx;
+  char *run = p + 1;
+  size_t len = 0;
+
+  for (;;) {
+    char *q = slex_simd_find(simd, run, 2, 1);
+    // without a closing quote stage 1 has no more ends
+    if (q >= ctx->stream_end) return 0;
+    size_t n = (size_t)(q - run);
+    if (n > ctx->string_store_len - len) return 0;
+    if (values) memcpy(ctx->string_store + len, run, n);
+    len += n;
+
+    if (*q != '\\') {
+      ctx->tok_ty = *p == '"' ? SLEX_TOK_str_lit : SLEX_TOK_char_lit;
+      ctx->first_tok_char = p;
+      ctx->last_tok_char = q;
+      ctx->parse_point = q + 1;
+      ctx->str_len = len;
+      return 1;
+    }
+
+    ctx->parse_point = q;
+    slex_i64 c = slex_parse_esc_seq(ctx);
+    if (c == -1) return 0;
+    int encoded = slex_utf8_encode_esc_seq(ctx, c, ctx->string_store + len);
+    if (encoded == -1) return 0;
+    len += (size_t)encoded;
+    run = ctx->parse_point;
+  }
+}
+
+// The next token into simd->ctx. Literals are only copied to the string store if values
+// are wanted.
+__attribute__((always_inline))
+static inline int slex_simd_lex(SlexSimd *simd, SlexSimdCursor *cur, slex_bool values) {
+  SlexContext *ctx = &simd->ctx;
+  char *end = ctx->stream_end;
+
+  if (!simd->synced) {
+    int ok = slex_simd_lexer_get_next_token(ctx);
+    // a token the lexer starts on a start bit is outside of comments and literals for both
+    if (ok && ctx->tok_ty != SLEX_TOK_eof && slex_simd_is_start(simd, ctx->first_tok_char)) {
+      simd->synced = 1;
+      slex_simd_seek(simd, cur, ctx->parse_point);
+    }
+    return ok;
+  }
+
+  // the next token starts at the next token start; past the last one the lexer finds the
+  // end (or the comment that doesn't end)
+  while (!cur->pending) {
+    if (cur->block + 1 >= simd->index_blocks)
+      return slex_simd_lexer_get_next_token(ctx);
+    cur->pending = slex_simd_token_starts(simd, ++cur->block);
+  }
+  size_t at = slex_simd_lowest_bit(cur->pending);
+  char *p = simd->stream_begin + cur->block * 64 + at;
+
+  char *last;
+  int tok_ty;
+  if (slex_simd_is_ident(*p) && !slex_simd_is_digit(*p)) {
+    // the identifier characters left in the block, unless it goes on into the next one
+    slex_u64 rest = ~simd->index[cur->block * 3 + 1] >> at;
+    char *ident_end = rest ? p + slex_simd_lowest_bit(rest) : slex_simd_find(simd, p, 1, 0);
+    // the index only knows ASCII, an identifier going on with UTF-8 is left to the lexer
+    if (ident_end < end && (unsigned char)*ident_end >= 0x80)
+      return slex_simd_fall_back(simd, cur, p);
+    cur->pending &= cur->pending - 1;
+    tok_ty = SLEX_TOK_identifier;
+    last = ident_end - 1;
+  } else if (slex_simd_is_digit(*p)) {
+    if (!slex_simd_number(ctx, p))
+      return slex_simd_fall_back(simd, cur, p);
+    slex_simd_skip_to(simd, cur, ctx->parse_point);
+    return 1;
+  } else if (*p == '"' || *p == '\'') {
+    if (!slex_simd_literal(simd, p, values))
+      return slex_simd_fall_back(simd, cur, p);
+    slex_simd_skip_to(simd, cur, ctx->parse_point);
+    return 1;
+  } else {
+    tok_ty = slex_simd_punctuator(p, end, &last);
+    if (tok_ty < 0)
+      return slex_simd_fall_back(simd, cur, p);
+    cur->pending &= cur->pending - 1;
+    if (last != p)
+      slex_simd_skip_to(simd, cur, last + 1);
+  }
+  ctx->tok_ty = tok_ty;
+  ctx->first_tok_char = p;
+  ctx->last_tok_char = last;
+  ctx->parse_point = last + 1;
+  return 1;
+}
+
+// Whether the index still lines up with the lexer at parse_point: it is where stage 2 left
+// it, or one past an error.
+static inline void slex_simd_check_sync(SlexSimd *simd) {
+  char *p = simd->ctx.parse_point;
+  if (p == simd->left_at) return;
+  if (simd->failed && p == simd->left_at + 1)
+    slex_simd_skip_to(simd, &simd->cursor, p);
+  else
+    simd->synced = 0;
+}
+
+int slex_simd_next_token(SlexSimd *simd) {
+  slex_simd_check_sync(simd);
+  int ok = slex_simd_lex(simd, &simd->cursor, 1);
+  simd->left_at = simd->ctx.parse_point;
+  simd->failed = !ok;
+  return ok;
+}
+
+int slex_simd_tokenize(SlexSimd *simd, SlexToken *tokens, size_t token_cap, size_t *token_count) {
+  SlexContext *ctx = &simd->ctx;
+  size_t count = 0;
+  int res = 0;
+
+  slex_simd_check_sync(simd);
+  simd->failed = 0;
+  // a copy the compiler can keep in registers
+  SlexSimdCursor cursor = simd->cursor;
+  for (;;) {
+    if (count == token_cap) {
+      ctx->tok_ty = SLEX_ERR_would_block;
+      break;
+    }
+    if (!slex_simd_lex(simd, &cursor, 0)) {
+      simd->failed = 1;
+      break;
+    }
+    if (ctx->tok_ty == SLEX_TOK_eof) {
+      res = 1;
+      break;
+    }
+    tokens[count].tok_ty = ctx->tok_ty;
+    tokens[count].first_tok_char = ctx->first_tok_char;
+    tokens[count].last_tok_char = ctx->last_tok_char;
+    count++;
+  }
+  simd->cursor = cursor;
+  simd->left_at = ctx->parse_point;
+  *token_count = count;
+  return res;
+}
+
+// The length of the valid UTF-8 sequence at p, or 0 if it is invalid.
+static inline size_t slex_simd_utf8_len(const unsigned char *p, size_t avail) {
+  unsigned char b = p[0];
+  unsigned char lo = 0x80;
+  unsigned char hi = 0xBF;
+  size_t len;
+
+  if (b < 0x80) return 1;
+  if (b >= 0xC2 && b <= 0xDF) {
+    len = 2;
+  } else if (b >= 0xE0 && b <= 0xEF) {
+    len = 3;
+    if (b == 0xE0) lo = 0xA0;      // overlong
+    else if (b == 0xED) hi = 0x9F; // surrogates
+  } else if (b >= 0xF0 && b <= 0xF4) {
+    len = 4;
+    if (b == 0xF0) lo = 0x90;      // overlong
+    else if (b == 0xF4) hi = 0x8F; // above U+10FFFF
+  } else {
+    return 0;
+  }
+
+  if (avail < len || p[1] < lo || p[1] > hi) return 0;
+  for (size_t i = 2; i < len; i++) {
+    if ((p[i] & 0xC0) != 0x80) return 0;
+  }
+  return len;
+}
+
+// Validates from i, where a sequence starts, skipping ASCII 8 bytes at a time.
+static inline size_t slex_simd_validate_utf8_portable(const char *text, size_t i, size_t len) {
+  const unsigned char *p = (const unsigned char *)text;
+
+  while (i < len) {
+    if (len - i >= 8) {
+      slex_u64 word;
+      memcpy(&word, p + i, 8);
+      if (!(word & 0x8080808080808080ull)) {
+        i += 8;
+        continue;
+      }
+    }
+    size_t n = slex_simd_utf8_len(p + i, len - i);
+    if (!n) return i;
+    i += n;
+  }
+  return len;
+}
+
+#if SLEX_SIMD_X86
+
+// Error bits of the lookup tables of Keiser and Lemire, "Validating UTF-8 In Less Than One
+// Instruction Per Byte" (2021). Each byte is looked up by the high and low nibble of the
+// byte before it and by its own high nibble; a bit set in all three is an error, except
+// that TWO_CONTS is expected where a third or fourth byte of a sequence has to be.
+enum {
+  SLEX_UTF8_TOO_SHORT = 1 << 0,  // a lead byte not followed by a continuation
+  SLEX_UTF8_TOO_LONG = 1 << 1,   // a continuation after ASCII
+  SLEX_UTF8_OVERLONG_3 = 1 << 2,
+  SLEX_UTF8_TOO_LARGE = 1 << 3,
+  SLEX_UTF8_SURROGATE = 1 << 4,
+  SLEX_UTF8_OVERLONG_2 = 1 << 5,
+  SLEX_UTF8_TOO_LARGE_1000 = 1 << 6,
+  SLEX_UTF8_OVERLONG_4 = 1 << 6,
+  SLEX_UTF8_TWO_CONTS = 1 << 7,
+  SLEX_UTF8_CARRY = SLEX_UTF8_TOO_SHORT | SLEX_UTF8_TOO_LONG | SLEX_UTF8_TWO_CONTS
+};
+
+__attribute__((target("avx2")))
+static inline __m256i slex_simd_table32(char t0, char t1, char t2, char t3, char t4, char t5, char t6, char t7,
+                                        char t8, char t9, char t10, char t11, char t12, char t13, char t14, char t15) {
+  return _mm256_broadcastsi128_si256(_mm_setr_epi8(t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15));
+}
+
+// Nonzero bytes where the 32 bytes of input, following prev, are not valid UTF-8.
+__attribute__((target("avx2")))
+static inline __m256i slex_simd_utf8_errors(__m256i input, __m256i prev) {
+  const char long1 = SLEX_UTF8_TOO_LONG;
+  const char cont1 = (char)SLEX_UTF8_TWO_CONTS;
+  const char short2 = SLEX_UTF8_TOO_SHORT;
+  const char carry = (char)SLEX_UTF8_CARRY;
+  const char large = (char)(SLEX_UTF8_CARRY | SLEX_UTF8_TOO_LARGE | SLEX_UTF8_TOO_LARGE_1000);
+  const __m256i byte_1_high = slex_simd_table32(long1, long1, long1, long1, long1, long1, long1, long1,
+    cont1, cont1, cont1, cont1,
+    SLEX_UTF8_TOO_SHORT | SLEX_UTF8_OVERLONG_2,
+    SLEX_UTF8_TOO_SHORT,
+    SLEX_UTF8_TOO_SHORT | SLEX_UTF8_OVERLONG_3 | SLEX_UTF8_SURROGATE,
+    SLEX_UTF8_TOO_SHORT | SLEX_UTF8_TOO_LARGE | SLEX_UTF8_TOO_LARGE_1000 | SLEX_UTF8_OVERLONG_4);
+  const __m256i byte_1_low = slex_simd_table32(
+    (char)(SLEX_UTF8_CARRY | SLEX_UTF8_OVERLONG_3 | SLEX_UTF8_OVERLONG_2 | SLEX_UTF8_OVERLONG_4),
+    (char)(SLEX_UTF8_CARRY | SLEX_UTF8_OVERLONG_2),
+    carry, carry,
+    (char)(SLEX_UTF8_CARRY | SLEX_UTF8_TOO_LARGE),
+    large, large, large, large, large, large, large, large,
+    (char)(SLEX_UTF8_CARRY | SLEX_UTF8_TOO_LARGE | SLEX_UTF8_TOO_LARGE_1000 | SLEX_UTF8_SURROGATE),
+    large, large);
+  const __m256i byte_2_high = slex_simd_table32(short2, short2, short2, short2, short2, short2, short2, short2,
+    (char)(SLEX_UTF8_TOO_LONG | SLEX_UTF8_OVERLONG_2 | SLEX_UTF8_TWO_CONTS | SLEX_UTF8_OVERLONG_3 |
+           SLEX_UTF8_TOO_LARGE_1000 | SLEX_UTF8_OVERLONG_4),
+    (char)(SLEX_UTF8_TOO_LONG | SLEX_UTF8_OVERLONG_2 | SLEX_UTF8_TWO_CONTS | SLEX_UTF8_OVERLONG_3 | SLEX_UTF8_TOO_LARGE),
+    (char)(SLEX_UTF8_TOO_LONG | SLEX_UTF8_OVERLONG_2 | SLEX_UTF8_TWO_CONTS | SLEX_UTF8_SURROGATE | SLEX_UTF8_TOO_LARGE),
+    (char)(SLEX_UTF8_TOO_LONG | SLEX_UTF8_OVERLONG_2 | SLEX_UTF8_TWO_CONTS | SLEX_UTF8_SURROGATE | SLEX_UTF8_TOO_LARGE),
+    short2, short2, short2, short2);
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+
+  // the input shifted by one, two and three bytes, with the end of prev shifted in
+  __m256i shifted = _mm256_permute2x128_si256(prev, input, 0x21);
+  __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+  __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+  __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+
+  __m256i special = _mm256_and_si256(
+    _mm256_and_si256(_mm256_shuffle_epi8(byte_1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                     _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(prev1, nibble))),
+    _mm256_shuffle_epi8(byte_2_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+
+  // the third and fourth bytes of a sequence have their high bit expected
+  __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+  __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+  __m256i expected = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char)0x80));
+  return _mm256_xor_si256(expected, special);
+}
+
+// Validates whole blocks of 32 bytes and returns where the scalar code has to go on: at
+// the first block with an error, or at the tail.
+__attribute__((target("avx2")))
+static size_t slex_simd_validate_utf8_avx2(const char *text, size_t len) {
+  // nonzero where the last bytes of a block start a sequence that goes on in the next one
+  const __m256i max_complete = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+  __m256i prev = _mm256_setzero_si256();
+  __m256i incomplete = _mm256_setzero_si256();
+  size_t i = 0;
+
+  for (; len - i >= 32; i += 32) {
+    __m256i input = _mm256_loadu_si256((const __m256i *)(text + i));
+    __m256i errors;
+    if (!_mm256_movemask_epi8(input)) {
+      // ASCII, only a sequence cut off by the previous block is an error
+      errors = incomplete;
+      incomplete = _mm256_setzero_si256();
+    } else {
+      errors = slex_simd_utf8_errors(input, prev);
+      incomplete = _mm256_subs_epu8(input, max_complete);
+    }
+    if (!_mm256_testz_si256(errors, errors)) break;
+    prev = input;
+  }
+  return i;
+}
+
+#endif // SLEX_SIMD_X86
+
+size_t slex_simd_validate_utf8(const char *text, size_t len) {
+  size_t i = 0;
+#if SLEX_SIMD_X86
+  if (__builtin_cpu_supports("avx2"))
+    i = slex_simd_validate_utf8_avx2(text, len);
+#endif
+  // Everything before i is valid except maybe a sequence started in its last three bytes,
+  // so the scalar code starts at the first sequence that begins there.
+  size_t start = i >= 3 ? i - 3 : 0;
+  while (start < i && ((unsigned char)text[start] & 0xC0) == 0x80) start++;
+  return slex_simd_validate_utf8_portable(text, start, len);
+}
+
+#endif // SLEX_SIMD_IMPLEMENTATION
+#endif // SLEX_SIMD_H
@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+// Finds the closer by lexing every token, which is what slex_skip_balanced replaces.
+static char *find_closer_by_lexing(SlexContext ctx, int open_ty) {
+  int depth = 1;
+  while (slex_get_next_token(&ctx) && ctx.tok_ty != SLEX_TOK_eof) {
+    if (ctx.tok_ty == open_ty) depth++;
+    else if (ctx.tok_ty == open_ty + 1 && --depth == 0) return ctx.first_tok_char;
+  }
+  return NULL;
+}
+
+static void check_buffer(char *text, int len) {
+  SlexContext ctx;
+  char store[1024];
+
+  slex_init_context(&ctx, text, text + len, store, 1024);
+  while (slex_get_next_token(&ctx) && ctx.tok_ty != SLEX_TOK_eof) {
+    if (ctx.tok_ty != SLEX_TOK_l_brace && ctx.tok_ty != SLEX_TOK_l_paren &&
+        ctx.tok_ty != SLEX_TOK_l_square_paren)
+      continue;
+
+    char *expected = find_closer_by_lexing(ctx, ctx.tok_ty);
+    SlexContext skip = ctx;
+    if (slex_skip_balanced(&skip)) {
+      expect(skip.first_tok_char == ctx.first_tok_char, "span starts at the opener");
+      expect(skip.last_tok_char == expected, "same closer as lexing");
+      expect(skip.parse_point == expected + 1, "parse point after the closer");
+    } else {
+      expect(expected == NULL && skip.tok_ty == SLEX_ERR_parse, "unbalanced region");
+    }
+  }
+}
+
+int main(void) {
+  FILE *f = fopen(TESTFILE, "rb");
+  char *text = (char *)malloc(1 << 20);
+  int len = f ? (int)fread(text, 1, 1 << 20, f) : -1;
+
+  if (len < 0) {
+    fprintf(stderr, "Error opening file\n");
+    free(text);
+    return 1;
+  }
+
+  fclose(f);
+  check_buffer(text, len);
+
+  char tricky[] = "{ a(\"}\\\"}\", '}', '\\'') /* } */ // }\n { [x] } \"{\" }";
+  check_buffer(tricky, (int)strlen(tricky));
+
+  char unbalanced[] = "{ { } /* }";
+  check_buffer(unbalanced, (int)strlen(unbalanced));
+
+  free(text);
+  if (failures) return 1;
+  printf("+ All balanced region tests passed\n");
+  return 0;
+}
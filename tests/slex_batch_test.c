@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+static char *snippets[] = {
+  "a + b * 3",
+  "",
+  "   ",
+  "x = $y",            // unknown token
+  "\"abc",             // unterminated string
+  "f(1.5e3, 'c')",
+  "// only a comment",
+  "/* unterminated",
+  "p->q[0] <<= 2;",
+  "0x",                // invalid int literal
+};
+
+#define SNIPPET_COUNT (sizeof(snippets) / sizeof(*snippets))
+
+// The batch has to give the same tokens and errors as lexing every snippet on its own.
+static void check_snippet(SlexInput input, const SlexBatchResult *res, const SlexToken *tokens, const char *what) {
+  SlexContext ctx;
+  char store[64];
+  size_t i = 0;
+  int same = 1;
+
+  slex_init_context(&ctx, input.begin, input.begin + input.len, store, sizeof(store));
+  for (;;) {
+    if (!slex_get_next_token(&ctx)) {
+      same &= res->status == ctx.tok_ty && res->error_offset == (size_t)(ctx.parse_point - input.begin);
+      break;
+    }
+    if (ctx.tok_ty == SLEX_TOK_eof) {
+      same &= res->status == SLEX_TOK_eof;
+      break;
+    }
+    same &= i < res->token_count && tokens[i].tok_ty == ctx.tok_ty &&
+      tokens[i].first_tok_char == ctx.first_tok_char && tokens[i].last_tok_char == ctx.last_tok_char;
+    i++;
+  }
+  expect(same && i == res->token_count, what);
+}
+
+static void test_batch(void) {
+  SlexInput inputs[SNIPPET_COUNT];
+  SlexBatchResult results[SNIPPET_COUNT];
+  SlexToken tokens[256];
+  char store[64];
+
+  for (size_t i = 0; i < SNIPPET_COUNT; i++) {
+    inputs[i].begin = snippets[i];
+    inputs[i].len = strlen(snippets[i]);
+  }
+
+  size_t done = slex_tokenize_batch(inputs, SNIPPET_COUNT, tokens, 256, results, store, sizeof(store));
+  expect(done == SNIPPET_COUNT, "the whole batch is done");
+  size_t next = 0;
+  for (size_t i = 0; i < SNIPPET_COUNT; i++) {
+    expect(results[i].first_token == next, "ranges follow each other");
+    next += results[i].token_count;
+    check_snippet(inputs[i], &results[i], tokens + results[i].first_token, snippets[i]);
+  }
+  expect(results[3].status == SLEX_ERR_unknown_tok && results[3].error_offset == 4, "error status and offset");
+  expect(results[5].status == SLEX_TOK_eof, "a snippet after errors is lexed");
+}
+
+// With a small token buffer the batch is done in several calls.
+static void test_small_buffer(void) {
+  SlexInput inputs[SNIPPET_COUNT];
+  SlexBatchResult results[SNIPPET_COUNT];
+  SlexToken tokens[8];
+  char store[64];
+
+  for (size_t i = 0; i < SNIPPET_COUNT; i++) {
+    inputs[i].begin = snippets[i];
+    inputs[i].len = strlen(snippets[i]);
+  }
+
+  size_t start = 0;
+  int calls = 0;
+  while (start < SNIPPET_COUNT && calls < 100) {
+    size_t done = slex_tokenize_batch(inputs + start, SNIPPET_COUNT - start, tokens, 8, results, store, sizeof(store));
+    expect(done > 0, "every call makes progress");
+    for (size_t i = 0; i < done; i++) {
+      if (results[i].status == SLEX_ERR_storage && results[i].token_count == 8) {
+        // p->q[0] <<= 2; has 9 tokens and is cut off
+        expect(i == 0 && strcmp(snippets[start], "p->q[0] <<= 2;") == 0, "only an oversized input is cut off");
+        expect(results[i].error_offset == 13, "the cut is at the first token that didn't fit");
+        continue;
+      }
+      check_snippet(inputs[start + i], &results[i], tokens + results[i].first_token, snippets[start + i]);
+    }
+    start += done;
+    calls++;
+  }
+  expect(start == SNIPPET_COUNT && calls > 1, "the batch is split over several calls");
+}
+
+// Many one-line snippets carved out of sample.c.
+static void test_lines(void) {
+  FILE *file = fopen("sample.c", "rb");
+  if (!file) {
+    expect(0, "cannot open sample.c");
+    return;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) len = 0;
+  fclose(file);
+
+  SlexInput *inputs = (SlexInput *)malloc(len * sizeof(SlexInput) + 1);
+  size_t count = 0;
+  char *line = text;
+  for (size_t i = 0; i < len; i++) {
+    if (text[i] != '\n') continue;
+    inputs[count].begin = line;
+    inputs[count].len = (size_t)(text + i - line);
+    count++;
+    line = text + i + 1;
+  }
+
+  SlexBatchResult *results = (SlexBatchResult *)malloc(count * sizeof(SlexBatchResult) + 1);
+  SlexToken *tokens = (SlexToken *)malloc(len * sizeof(SlexToken) + 1);
+  char store[1024];
+  expect(slex_tokenize_batch(inputs, count, tokens, len, results, store, sizeof(store)) == count, "all lines are done");
+  for (size_t i = 0; i < count; i++)
+    check_snippet(inputs[i], &results[i], tokens + results[i].first_token, "line of sample.c");
+
+  free(results);
+  free(tokens);
+  free(inputs);
+  free(text);
+}
+
+int main(void) {
+  test_batch();
+  test_small_buffer();
+  test_lines();
+
+  if (failures) return 1;
+  printf("+ All batch tests passed\n");
+  return 0;
+}
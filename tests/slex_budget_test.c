@@ -0,0 +1,292 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#define SLEX_COUNT_STEPS 1
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_trivia_
+#define SLEX_EMIT_TRIVIA 1
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_lazy_
+#define SLEX_LAZY_LITERALS 1
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_skip_
+#define SLEX_SKIP_PREPROCESSOR 1
+#include "../src/slex.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+typedef struct {
+  const char *name;
+  void (*init_context)(SlexContext *, char *, char *, char *, size_t);
+  int (*get_next_token)(SlexContext *);
+  int (*get_next_token_budgeted)(SlexContext *, size_t *);
+} Instance;
+
+static const Instance instances[] = {
+  {"default", slex_init_context, slex_get_next_token, slex_get_next_token_budgeted},
+  {"trivia", slex_trivia_init_context, slex_trivia_get_next_token, slex_trivia_get_next_token_budgeted},
+  {"lazy", slex_lazy_init_context, slex_lazy_get_next_token, slex_lazy_get_next_token_budgeted},
+  {"skip", slex_skip_init_context, slex_skip_get_next_token, slex_skip_get_next_token_budgeted},
+};
+
+// A budgeted call until it doesn't block, with a fresh budget for each call.
+static int next_budgeted(const Instance *in, SlexContext *ctx, size_t budget, size_t *calls) {
+  for (;;) {
+    size_t left = budget;
+    int ok = in->get_next_token_budgeted(ctx, &left);
+    (*calls)++;
+    if (ok || ctx->tok_ty != SLEX_ERR_would_block) return ok;
+  }
+}
+
+// Lexing with any budget gives the tokens, values and errors of lexing without one.
+static int compare(const Instance *in, char *text, size_t len, size_t budget, size_t *calls) {
+  SlexContext plain;
+  SlexContext budgeted;
+  char plain_store[1024];
+  char budgeted_store[1024];
+
+  in->init_context(&plain, text, text + len, plain_store, sizeof(plain_store));
+  in->init_context(&budgeted, text, text + len, budgeted_store, sizeof(budgeted_store));
+  for (;;) {
+    int ok = in->get_next_token(&plain);
+    int budgeted_ok = next_budgeted(in, &budgeted, budget, calls);
+
+    if (ok != budgeted_ok || plain.tok_ty != budgeted.tok_ty || plain.parse_point != budgeted.parse_point)
+      return 0;
+    if (!ok) {
+      if (plain.parse_point >= plain.stream_end) return 1;
+      plain.parse_point++;
+      budgeted.parse_point++;
+      continue;
+    }
+    if (plain.tok_ty == SLEX_TOK_eof) return 1;
+    if (plain.first_tok_char != budgeted.first_tok_char || plain.last_tok_char != budgeted.last_tok_char)
+      return 0;
+    if (in->get_next_token == slex_get_next_token) {
+      if (plain.tok_ty == SLEX_TOK_str_lit || plain.tok_ty == SLEX_TOK_char_lit) {
+        if (plain.str_len != budgeted.str_len || memcmp(plain_store, budgeted_store, plain.str_len) != 0)
+          return 0;
+      }
+      if (plain.tok_ty == SLEX_TOK_int_lit && plain.parsed_int_lit != budgeted.parsed_int_lit)
+        return 0;
+    }
+  }
+}
+
+static void compare_all(char *text, size_t len, const char *what) {
+  static const size_t budgets[] = {1, 2, 3, 7, 64, (size_t)-1};
+  for (size_t i = 0; i < sizeof(instances) / sizeof(*instances); i++) {
+    for (size_t j = 0; j < sizeof(budgets) / sizeof(*budgets); j++) {
+      size_t calls = 0;
+      if (!compare(&instances[i], text, len, budgets[j], &calls)) {
+        printf("  %s lexer, budget %zu: %.*s\n", instances[i].name, budgets[j], (int)(len > 200 ? 200 : len), text);
+        expect(0, what);
+        return;
+      }
+    }
+  }
+}
+
+// A long comment or literal takes many calls, and none of them walks much more than its budget.
+static void test_bounded_calls(void) {
+  size_t len = 1 << 20;
+  char *text = (char *)malloc(len);
+  char *store = (char *)malloc(len);
+  SlexContext ctx;
+
+  static const char *const openers[] = {"/*", "//", "\""};
+  for (int i = 0; i < 3; i++) {
+    memset(text, 'x', len);
+    memcpy(text, openers[i], strlen(openers[i]));
+    slex_init_context(&ctx, text, text + len, store, len);
+
+    size_t blocked = 0;
+    slex_bool bounded = 1;
+    for (;;) {
+      size_t budget = 4096;
+      slex_u64 steps = ctx.steps;
+      int ok = slex_get_next_token_budgeted(&ctx, &budget);
+      bounded &= ctx.steps - steps <= 4096 + SLEX_PARTIAL_MARGIN;
+      if (ok || ctx.tok_ty != SLEX_ERR_would_block) break;
+      blocked++;
+    }
+    expect(bounded, "a budgeted call walks about its budget");
+    expect(blocked >= len / 4096 - 1, "a long construct blocks many times");
+  }
+  expect(ctx.tok_ty == SLEX_ERR_parse && ctx.parse_point == text + len, "an unterminated literal fails at the end");
+
+  memset(text, ' ', len);
+  memcpy(text, "/*", 2);
+  slex_init_context(&ctx, text, text + len, store, len);
+  size_t budget = (size_t)-1;
+  expect(!slex_get_next_token_budgeted(&ctx, &budget) && ctx.tok_ty == SLEX_ERR_parse &&
+         ctx.parse_point == text + len, "an unterminated comment fails at the end");
+  free(store);
+  free(text);
+}
+
+static void test_resume(void) {
+  char text[] = "a /* long comment */ \"str\\n\" 123";
+  SlexContext ctx;
+  char store[64];
+
+  slex_init_context(&ctx, text, text + strlen(text), store, sizeof(store));
+  size_t budget = 4;
+  expect(slex_get_next_token_budgeted(&ctx, &budget) && ctx.tok_ty == SLEX_TOK_identifier && budget == 3,
+         "a short token spends its length");
+  expect(!slex_get_next_token_budgeted(&ctx, &budget) && ctx.tok_ty == SLEX_ERR_would_block && budget == 0,
+         "the budget runs out in the comment");
+  expect(ctx.parse_point == text + 2 && ctx.resume_state != 0, "parse_point stays at the comment");
+  budget = 30;
+  expect(slex_get_next_token_budgeted(&ctx, &budget) && ctx.tok_ty == SLEX_TOK_str_lit &&
+         ctx.str_len == 4 && memcmp(store, "str\n", 4) == 0, "the comment is resumed");
+
+  // moving parse_point drops the progress
+  slex_init_context(&ctx, text, text + strlen(text), store, sizeof(store));
+  budget = 5;
+  slex_get_next_token_budgeted(&ctx, &budget);
+  expect(!slex_get_next_token_budgeted(&ctx, &budget) && ctx.tok_ty == SLEX_ERR_would_block, "blocked in the comment");
+  ctx.parse_point = text + 21;
+  budget = 100;
+  expect(slex_get_next_token_budgeted(&ctx, &budget) && ctx.tok_ty == SLEX_TOK_str_lit, "stale progress is dropped");
+}
+
+static void test_tokenize(void) {
+  char text[] = "int x = 1; /* c */ x += 2;";
+  SlexContext ctx;
+  SlexToken tokens[4];
+  char store[64];
+  size_t total = 0;
+  size_t count;
+  int calls = 0;
+
+  slex_init_context(&ctx, text, text + strlen(text), store, sizeof(store));
+  for (;;) {
+    calls++;
+    int done = slex_tokenize_budgeted(&ctx, tokens, 4, 6, &count);
+    expect(count <= 4, "at most token_cap tokens");
+    total += count;
+    if (done) break;
+    if (ctx.tok_ty != SLEX_ERR_would_block) {
+      expect(0, "only budgets stop it");
+      break;
+    }
+  }
+  expect(total == 9, "all tokens are written");
+  expect(calls > 3, "the byte budget stops it too");
+}
+
+// Input arrives in chunks and every call has a small budget: progress is kept for both.
+static void test_partial(char *text, size_t len) {
+  SlexContext plain;
+  SlexContext ctx;
+  char plain_store[1024];
+  char store[1024];
+  size_t avail = 0;
+
+  slex_init_context(&plain, text, text + len, plain_store, sizeof(plain_store));
+  slex_init_context(&ctx, text, text, store, sizeof(store));
+  ctx.stream_is_partial = 1;
+  for (;;) {
+    size_t budget = 5;
+    int ok = slex_get_next_token_budgeted(&ctx, &budget);
+    if (!ok && ctx.tok_ty == SLEX_ERR_would_block) continue;
+    if (!ok && ctx.tok_ty == SLEX_ERR_need_input) {
+      avail = avail + 37 < len ? avail + 37 : len;
+      ctx.stream_end = text + avail;
+      ctx.stream_is_partial = avail < len;
+      continue;
+    }
+    int plain_ok = slex_get_next_token(&plain);
+    if (ok != plain_ok || ctx.tok_ty != plain.tok_ty || ctx.parse_point != plain.parse_point) {
+      expect(0, "a partial stream lexed with a budget gives the same tokens");
+      return;
+    }
+    if (!ok) {
+      if (plain.parse_point >= plain.stream_end) return;
+      plain.parse_point++;
+      ctx.parse_point++;
+    }
+    else if (plain.tok_ty == SLEX_TOK_eof) {
+      return;
+    }
+  }
+}
+
+static unsigned long long seed = 0x9e3779b97f4a7c15ull;
+
+static unsigned random_below(unsigned n) {
+  seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+  return (unsigned)(seed >> 33) % n;
+}
+
+static const char *fragments[] = {
+  "a", "_x1", "L", "\xc3\xa9", "\xff", "1", "0x1f", "1e+5", "1.5e-3", "0b1", "017", "9999999999999999999999",
+  "\"s\"", "\"a\\n\\x41\\u00e9\"", "'c'", "'\\''", "\"", "'", "/", "*", "/* c */", "/**/", "/** d */",
+  "// c\n", "/// d\n", "/*", "//", "#define X 1\n", "#if A \\\n B\n", "#", "\\", " ", "  \t", "\n", "\n\n",
+  "a.a.a", "e+e+e", "1.1.1", "0x11111111111111111", "00000000000000000000000017", "1.000000000000000000001",
+  "+", "+=", "<<=", "...", ".", "->", "@", "$", ";",
+};
+
+static void test_random_sources(void) {
+  char buf[512];
+
+  for (int round = 0; round < 3000; round++) {
+    size_t len = 0;
+    int pieces = 1 + (int)random_below(40);
+    for (int i = 0; i < pieces; i++) {
+      const char *frag = fragments[random_below(sizeof(fragments) / sizeof(*fragments))];
+      size_t frag_len = strlen(frag);
+      if (len + frag_len > sizeof(buf)) break;
+      memcpy(buf + len, frag, frag_len);
+      len += frag_len;
+    }
+    size_t before = (size_t)failures;
+    compare_all(buf, len, "random source lexes the same with a budget");
+    test_partial(buf, len);
+    if ((size_t)failures != before) return;
+  }
+}
+
+int main(void) {
+  FILE *file = fopen(TESTFILE, "rb");
+  if (!file) {
+    printf("- FAILED: cannot open %s\n", TESTFILE);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) {
+    printf("- FAILED: cannot read %s\n", TESTFILE);
+    return 1;
+  }
+  fclose(file);
+
+  compare_all(text, len, "sample.c lexes the same with a budget");
+  test_partial(text, len);
+  test_bounded_calls();
+  test_resume();
+  test_tokenize();
+  test_random_sources();
+  free(text);
+
+  if (failures) return 1;
+  printf("+ All budgeted lexing tests passed\n");
+  return 0;
+}
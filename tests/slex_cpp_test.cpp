@@ -0,0 +1,84 @@
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "../src/slex.hpp"
+
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+#define TESTFILE "sample.c"
+
+// Tokens can be produced and inspected at compile time.
+static_assert(slex::count_tokens("int x = 0x10;") == 5);
+static_assert(slex::tokenize("a::b")[1].type == SLEX_TOK_scope_resolution);
+static_assert(slex::tokenize("x = 0x10;")[2].int_value() == 16);
+static_assert(slex::tokenize("y = 2.5e1;")[2].float_value() == 25.0);
+static_assert(slex::tokenize("/* comment */ foo")[0].text == "foo");
+static_assert(slex::tokenize("a $ b")[1].is_error());
+static_assert(slex::tokenize("\xce\xb1 = x\xc3\xa9;")[2].text == "x\xc3\xa9");
+
+constexpr std::array<std::string_view, 3> keywords = {"if", "else", "while"};
+constexpr bool all_identifiers() {
+  for (std::string_view keyword : keywords) {
+    slex::TokenBuffer tokens = slex::tokenize(keyword);
+    if (tokens.size() != 1 || tokens[0].type != SLEX_TOK_identifier || tokens[0].text != keyword)
+      return false;
+  }
+  return true;
+}
+static_assert(all_identifiers());
+
+static int failures = 0;
+
+static void expect(bool cond, const char *what) {
+  if (!cond) {
+    std::printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+int main() {
+  std::FILE *f = std::fopen(TESTFILE, "rb");
+  char *text = (char *)std::malloc(1 << 20);
+  int len = f ? (int)std::fread(text, 1, 1 << 20, f) : -1;
+
+  if (len < 0) {
+    std::fprintf(stderr, "Error opening file\n");
+    std::free(text);
+    return 1;
+  }
+
+  std::fclose(f);
+
+  // The wrapper yields exactly what the C loop does.
+  SlexContext ctx;
+  char store[1024];
+  slex_init_context(&ctx, text, text + len, store, 1024);
+
+  slex::TokenBuffer tokens = slex::tokenize(std::string_view(text, len));
+  std::size_t i = 0;
+  while (slex_get_next_token(&ctx) && ctx.tok_ty != SLEX_TOK_eof) {
+    std::string_view expected(ctx.first_tok_char, ctx.last_tok_char - ctx.first_tok_char + 1);
+    expect(i < tokens.size() && tokens[i].type == ctx.tok_ty && tokens[i].text == expected,
+           "same token as the C loop");
+
+    if (i < tokens.size() && ctx.tok_ty == SLEX_TOK_str_lit) {
+      char decoded[1024];
+      std::optional<std::size_t> decoded_len = tokens[i].decode_string(decoded);
+      expect(decoded_len && *decoded_len == (std::size_t)ctx.str_len &&
+             std::memcmp(decoded, store, ctx.str_len) == 0, "decoded string");
+    }
+    i++;
+  }
+  expect(i == tokens.size(), "same token count");
+
+  slex::TokenBuffer moved = std::move(tokens);
+  std::span<const slex::Token> span = moved.tokens();
+  expect(span.size() == i && span.data() == &moved[0], "span over the buffer");
+
+  std::free(text);
+  if (failures) return 1;
+  std::printf("+ All C++ wrapper tests passed\n");
+  return 0;
+}
@@ -0,0 +1,376 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+// small slices, so sample.c is read and lexed in several
+#define SLEX_DAEMON_SLICE 1024
+#define SLEX_DAEMON_IMPLEMENTATION
+#include "../src/slex_daemon.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+static char dir[] = "/tmp/slex-daemon-XXXXXX";
+
+static void path_in_dir(char *out, const char *name) {
+  snprintf(out, 256, "%s/%s", dir, name);
+}
+
+static void write_file(const char *name, const char *text, size_t len) {
+  char path[256];
+  path_in_dir(path, name);
+  FILE *f = fopen(path, "wb");
+  fwrite(text, 1, len, f);
+  fclose(f);
+}
+
+static void remove_file(const char *name) {
+  char path[256];
+  path_in_dir(path, name);
+  unlink(path);
+}
+
+static int lex_file(SlexDaemonClient *client, const char *name, SlexDaemonLexed *lexed) {
+  char path[256];
+  path_in_dir(path, name);
+  return slex_daemon_lex(client, path, lexed);
+}
+
+// The tokens have to be those of the usual error loop, over the same text.
+static int same_as_lexer(const SlexDaemonLexed *lexed, const char *text, size_t len) {
+  if (lexed->text_len != len || memcmp(lexed->text, text, len) != 0) return 0;
+  for (size_t i = 0; i < SLEX_PADDING; i++) {
+    if (lexed->text[len + i] != 0) return 0;
+  }
+
+  char *copy = (char *)malloc(len + 1);
+  char store[4096];
+  memcpy(copy, text, len);
+  SlexContext ctx;
+  slex_init_context(&ctx, copy, copy + len, store, sizeof(store));
+  size_t n = 0;
+  int same = 1;
+  for (;;) {
+    const SlexDaemonToken *t = n < lexed->token_count ? &lexed->tokens[n++] : NULL;
+    if (!t) {
+      same = 0;
+      break;
+    }
+    if (!slex_get_next_token(&ctx)) {
+      same = t->tok_ty == ctx.tok_ty && t->offset == (size_t)(ctx.parse_point - copy) && t->len == 0;
+      if (!same || ctx.parse_point >= ctx.stream_end) break;
+      ctx.parse_point++;
+      continue;
+    }
+    if (ctx.tok_ty == SLEX_TOK_eof) {
+      same = t->tok_ty == SLEX_TOK_eof && t->offset == len && n == lexed->token_count;
+      break;
+    }
+    same = t->tok_ty == ctx.tok_ty && t->offset == (size_t)(ctx.first_tok_char - copy) &&
+      t->len == (size_t)(ctx.last_tok_char - ctx.first_tok_char + 1);
+    if (!same) break;
+  }
+  free(copy);
+  return same;
+}
+
+// The size of the segment the daemon makes for text.
+static size_t segment_size(const char *text, size_t len) {
+  char *copy = (char *)malloc(len + 1);
+  char store[4096];
+  memcpy(copy, text, len);
+  SlexContext ctx;
+  slex_init_context(&ctx, copy, copy + len, store, sizeof(store));
+  size_t n = 1;
+  for (;;) {
+    if (!slex_get_next_token(&ctx)) {
+      n++;
+      if (ctx.parse_point >= ctx.stream_end) break;
+      ctx.parse_point++;
+      continue;
+    }
+    if (ctx.tok_ty == SLEX_TOK_eof) break;
+    n++;
+  }
+  free(copy);
+  return sizeof(SlexDaemonHeader) + n * sizeof(SlexDaemonToken) + len + SLEX_PADDING;
+}
+
+static void *serve(void *arg) {
+  slex_daemon_serve((SlexDaemon *)arg);
+  return NULL;
+}
+
+static void test_daemon(char *text, size_t len) {
+  SlexDaemon daemon;
+  SlexDaemonClient client;
+  SlexDaemonLexed lexed;
+  SlexDaemonLexed again;
+  pthread_t server;
+  char socket_path[256];
+  path_in_dir(socket_path, "sock");
+
+  // a.c, b.c and c.c don't fit together
+  size_t budget = segment_size(text, len) + segment_size(text, len / 2) + segment_size(text, len / 3) - 1;
+  expect(slex_daemon_open(&daemon, socket_path, budget), "daemon opens");
+  pthread_create(&server, NULL, serve, &daemon);
+  expect(slex_daemon_connect(&client, socket_path), "client connects");
+
+  write_file("a.c", text, len);
+  write_file("b.c", text, len / 2);
+  write_file("c.c", text, len / 3);
+
+  expect(lex_file(&client, "a.c", &lexed) && same_as_lexer(&lexed, text, len), "file is lexed");
+  expect(daemon.lexes == 1 && daemon.hits == 0, "first request lexes");
+  expect(lex_file(&client, "a.c", &again) && same_as_lexer(&again, text, len), "cached file has the same tokens");
+  expect(daemon.lexes == 1 && daemon.hits == 1, "second request is a hit");
+  expect(mprotect(lexed.map, lexed.map_len, PROT_READ | PROT_WRITE) != 0, "segment is read-only");
+  slex_daemon_unmap(&again);
+
+  // literal values come back from the text
+  int found_int = 0;
+  for (size_t i = 0; i < lexed.token_count && !found_int; i++) {
+    SlexToken token;
+    unsigned long long value;
+    slex_daemon_token(&lexed, i, &token);
+    found_int = token.tok_ty == SLEX_TOK_int_lit && slex_token_int_value(&token, &value);
+  }
+  expect(found_int, "packed tokens convert to SlexToken");
+
+  // a new mtime with the same content is hashed, not lexed
+  char path[256];
+  path_in_dir(path, "a.c");
+  struct timespec times[2] = {{1000000, 0}, {1000000, 0}};
+  utimensat(AT_FDCWD, path, times, 0);
+  expect(lex_file(&client, "a.c", &again) && daemon.lexes == 1 && daemon.hits == 2, "touched file is a hit");
+  slex_daemon_unmap(&again);
+
+  // changed content is lexed again, the old mapping stays valid
+  write_file("a.c", "int x;", 6);
+  times[0].tv_sec = times[1].tv_sec = 2000000;
+  utimensat(AT_FDCWD, path, times, 0);
+  expect(lex_file(&client, "a.c", &again) && daemon.lexes == 2 && same_as_lexer(&again, "int x;", 6), "changed file is lexed again");
+  expect(same_as_lexer(&lexed, text, len), "old mapping is unchanged");
+  slex_daemon_unmap(&again);
+  slex_daemon_unmap(&lexed);
+
+  expect(slex_daemon_invalidate(&client, path), "file is invalidated");
+  expect(lex_file(&client, "a.c", &again) && daemon.lexes == 3, "invalidated file is lexed again");
+  slex_daemon_unmap(&again);
+
+  // c.c doesn't fit anymore, a.c was used least recently
+  write_file("a.c", text, len);
+  expect(lex_file(&client, "a.c", &again) && daemon.lexes == 4, "a.c is lexed");
+  slex_daemon_unmap(&again);
+  expect(lex_file(&client, "b.c", &again) && same_as_lexer(&again, text, len / 2), "b.c is lexed");
+  slex_daemon_unmap(&again);
+  expect(lex_file(&client, "c.c", &again) && same_as_lexer(&again, text, len / 3), "c.c is lexed");
+  slex_daemon_unmap(&again);
+  expect(daemon.lexes == 6 && daemon.used <= budget && daemon.entry_count == 2, "cache stays in its budget");
+  expect(lex_file(&client, "c.c", &again) && daemon.lexes == 6, "recently used file stays cached");
+  slex_daemon_unmap(&again);
+  expect(lex_file(&client, "a.c", &again) && daemon.lexes == 7, "least recently used file was evicted");
+  slex_daemon_unmap(&again);
+
+  // a second client is served while the first stays connected
+  SlexDaemonClient other;
+  expect(slex_daemon_connect(&other, socket_path) && lex_file(&other, "a.c", &again) && daemon.lexes == 7,
+    "second client shares the cache");
+  slex_daemon_unmap(&again);
+  slex_daemon_disconnect(&other);
+
+  expect(slex_daemon_invalidate(&client, NULL) && daemon.entry_count == 0 && daemon.used == 0, "whole cache is invalidated");
+  remove_file("b.c");
+  expect(!lex_file(&client, "b.c", &again) && errno == ENOENT, "missing file fails");
+  write_file("empty.c", "", 0);
+  expect(lex_file(&client, "empty.c", &again) && again.token_count == 1 && again.tokens[0].tok_ty == SLEX_TOK_eof,
+    "empty file has only eof");
+  slex_daemon_unmap(&again);
+
+  // a second server can't take over the socket of a running one
+  SlexDaemon second;
+  expect(!slex_daemon_open(&second, socket_path, 0) && errno == EADDRINUSE, "socket of a running server is kept");
+
+  slex_daemon_disconnect(&client);
+  slex_daemon_stop(&daemon);
+  pthread_join(server, NULL);
+  slex_daemon_close(&daemon);
+  expect(access(socket_path, F_OK) != 0, "socket is removed");
+  expect(!slex_daemon_connect(&client, socket_path), "stopped server refuses clients");
+
+  remove_file("a.c");
+  remove_file("c.c");
+  remove_file("empty.c");
+}
+
+// A client can't write to a segment, not even through a reopened /proc/self/fd link.
+static void test_sealed(char *text, size_t len) {
+#ifdef __linux__
+  SlexDaemon daemon;
+  SlexDaemonClient client;
+  pthread_t server;
+  char socket_path[256];
+  char path[PATH_MAX];
+  path_in_dir(socket_path, "sealed");
+
+  expect(slex_daemon_open(&daemon, socket_path, 1 << 20), "daemon opens");
+  pthread_create(&server, NULL, serve, &daemon);
+  expect(slex_daemon_connect(&client, socket_path), "client connects");
+  write_file("a.c", text, len);
+  path_in_dir(path, "a.c");
+
+  SlexDaemonReply reply;
+  int fd;
+  expect(slex_daemon_request(&client, SLEX_DAEMON_LEX, path, &reply, &fd) && reply.error == 0 && fd >= 0,
+    "segment descriptor comes with the reply");
+  void *map = mmap(NULL, reply.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  expect(map == MAP_FAILED, "segment can't be mapped writable");
+  if (map != MAP_FAILED) munmap(map, reply.size);
+  expect(ftruncate(fd, 0) != 0, "segment can't be resized");
+
+  char link[64];
+  snprintf(link, sizeof(link), "/proc/self/fd/%d", fd);
+  int rw = open(link, O_RDWR);
+  if (rw >= 0) {
+    map = mmap(NULL, reply.size, PROT_READ | PROT_WRITE, MAP_SHARED, rw, 0);
+    expect(map == MAP_FAILED && write(rw, "x", 1) < 0, "reopened segment can't be written");
+    if (map != MAP_FAILED) munmap(map, reply.size);
+    close(rw);
+  }
+  close(fd);
+
+  SlexDaemonLexed lexed;
+  expect(slex_daemon_lex(&client, path, &lexed) && same_as_lexer(&lexed, text, len), "cached tokens are intact");
+  slex_daemon_unmap(&lexed);
+
+  slex_daemon_disconnect(&client);
+  slex_daemon_stop(&daemon);
+  pthread_join(server, NULL);
+  slex_daemon_close(&daemon);
+  remove_file("a.c");
+#else
+  (void)text;
+  (void)len;
+#endif
+}
+
+// A client that stalls in the middle of a request holds up no other, a large file is
+// lexed in turns with the other clients and neither keeps the server from stopping.
+static void test_stalled(char *text, size_t len) {
+  SlexDaemon daemon;
+  SlexDaemonClient client;
+  SlexDaemonClient stalled;
+  SlexDaemonClient large;
+  SlexDaemonLexed lexed;
+  pthread_t server;
+  char socket_path[256];
+  char path[PATH_MAX];
+  path_in_dir(socket_path, "stalled");
+
+  expect(slex_daemon_open(&daemon, socket_path, 64 << 20), "daemon opens");
+  pthread_create(&server, NULL, serve, &daemon);
+  write_file("a.c", text, len);
+
+  // half a request header, then nothing
+  SlexDaemonRequest req = {SLEX_DAEMON_LEX, 0};
+  expect(slex_daemon_connect(&stalled, socket_path) && slex_daemon_send_all(stalled.fd, &req, 4),
+    "stalled client connects");
+  expect(slex_daemon_connect(&client, socket_path) && lex_file(&client, "a.c", &lexed) &&
+    same_as_lexer(&lexed, text, len), "a stalled client holds up no other");
+  slex_daemon_unmap(&lexed);
+
+  size_t large_len = 8 << 20;
+  char *large_text = (char *)malloc(large_len);
+  for (size_t i = 0; i < large_len; i += len) memcpy(large_text + i, text, i + len > large_len ? large_len - i : len);
+  write_file("large.c", large_text, large_len);
+  free(large_text);
+  path_in_dir(path, "large.c");
+  req.path_len = (slex_u32)strlen(path);
+  expect(slex_daemon_connect(&large, socket_path) && slex_daemon_send_all(large.fd, &req, sizeof(req)) &&
+    slex_daemon_send_all(large.fd, path, req.path_len), "large file is requested");
+
+  // the server gets to the large file before the next request comes
+  struct timespec pause = {0, 20 * 1000 * 1000};
+  nanosleep(&pause, NULL);
+  char byte;
+  expect(lex_file(&client, "a.c", &lexed) && recv(large.fd, &byte, 1, MSG_DONTWAIT | MSG_PEEK) < 0 && errno == EAGAIN,
+    "a large file is lexed in turns with the other clients");
+  slex_daemon_unmap(&lexed);
+
+  slex_daemon_stop(&daemon);
+  pthread_join(server, NULL);
+  expect(daemon.client_count == 3, "server stops with a stalled client and a file half lexed");
+  slex_daemon_close(&daemon);
+  slex_daemon_disconnect(&client);
+  slex_daemon_disconnect(&stalled);
+  slex_daemon_disconnect(&large);
+  remove_file("a.c");
+  remove_file("large.c");
+}
+
+// A socket left behind by a server that is gone is replaced.
+static void test_stale_socket(void) {
+  char socket_path[256];
+  path_in_dir(socket_path, "stale");
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, socket_path);
+  bind(fd, (struct sockaddr *)&addr, sizeof(addr));
+  close(fd);
+
+  SlexDaemon daemon;
+  expect(slex_daemon_open(&daemon, socket_path, 1 << 20), "stale socket is replaced");
+  slex_daemon_close(&daemon);
+}
+
+int main(void) {
+  FILE *file = fopen(TESTFILE, "rb");
+  if (!file) {
+    printf("- FAILED: cannot open %s\n", TESTFILE);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) {
+    printf("- FAILED: cannot read %s\n", TESTFILE);
+    return 1;
+  }
+  fclose(file);
+
+  if (!mkdtemp(dir)) {
+    printf("- FAILED: cannot create %s\n", dir);
+    return 1;
+  }
+  test_daemon(text, len);
+  test_sealed(text, len);
+  test_stalled(text, len);
+  test_stale_socket();
+  rmdir(dir);
+  free(text);
+
+  if (failures) return 1;
+  printf("+ All lexing daemon tests passed\n");
+  return 0;
+}
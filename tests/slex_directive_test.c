@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+static int span_is(const char *p, size_t len, const char *s) {
+  return len == strlen(s) && memcmp(p, s, len) == 0;
+}
+
+static char source[] =
+  "#include <stdio.h>\n"
+  "  #  include \"local/file.h\"  // trailing comment\n"
+  "#include MACRO_PATH\n"
+  "/* #include \"in_comment.h\"\n"
+  "#include \"still_in_comment.h\" */\n"
+  "const char *s = \"#include <in_string.h>\";\n"
+  "// #include <in_line_comment.h>\n"
+  "int x; #define NOT_AT_LINE_START\n"
+  "#define LONG_MACRO(a) \\\n"
+  "  #include <in_splice.h>\n"
+  "#if defined(A) && B\n"
+  "#error don't do this\n"
+  "#ifdef C\r\n"
+  "#include <crlf.h>\r\n"
+  "#elif D\n"
+  "#else\n"
+  "#endif\n"
+  "#endif\n"
+  "#\n"
+  "# 12 \"line_marker.c\"\n"
+  "char c = '\"'; #include <after_char.h>\n"
+  "#include <a//b.h>\n"
+  "/* c */ #include \"after_comment.h\"\n"
+  "/* multi\n"
+  "   line */ /**/ # include <after_comments.h>\n"
+  "int y; /* c */ #define NOT_AFTER_CODE\n"
+  "int z; /* multi\n"
+  "   line */ #define NOT_AFTER_CODE_EITHER\n"
+  "/* c */ x #define NOT_AFTER_A_TOKEN\n"
+  "#pragma once";
+
+static void test_source(void) {
+  SlexDirectiveScanner sc;
+  SlexDirective d[32];
+  size_t n = 0;
+
+  slex_init_directive_scanner(&sc, source, source + strlen(source));
+  while (n < 32 && slex_next_directive(&sc, &d[n])) n++;
+
+  expect(n == 16, "number of directives");
+  if (n != 16) {
+    for (size_t i = 0; i < n; i++)
+      printf("  %.*s %.*s\n", (int)d[i].name_len, d[i].name, (int)d[i].args_len, d[i].args);
+    return;
+  }
+
+  expect(span_is(d[0].name, d[0].name_len, "include") && span_is(d[0].args, d[0].args_len, "stdio.h") &&
+         d[0].include_kind == '<' && d[0].first_char == source, "angle include");
+  expect(span_is(d[1].name, d[1].name_len, "include") && span_is(d[1].args, d[1].args_len, "local/file.h") &&
+         d[1].include_kind == '"' && *d[1].first_char == '#', "quoted include with blanks");
+  expect(span_is(d[2].args, d[2].args_len, "MACRO_PATH") && d[2].include_kind == 0, "computed include");
+  expect(span_is(d[3].name, d[3].name_len, "define") &&
+         span_is(d[3].args, d[3].args_len, "LONG_MACRO(a) \\\n  #include <in_splice.h>"), "define with a line splice");
+  expect(span_is(d[4].name, d[4].name_len, "if") && span_is(d[4].args, d[4].args_len, "defined(A) && B") &&
+         d[4].depth == 0, "if");
+  expect(span_is(d[5].name, d[5].name_len, "error") && d[5].depth == 1, "error inside if");
+  expect(span_is(d[6].name, d[6].name_len, "ifdef") && span_is(d[6].args, d[6].args_len, "C") &&
+         d[6].depth == 1, "nested ifdef with CRLF");
+  expect(span_is(d[7].args, d[7].args_len, "crlf.h") && d[7].depth == 2, "include with CRLF");
+  expect(span_is(d[8].name, d[8].name_len, "elif") && d[8].depth == 1, "elif");
+  expect(span_is(d[9].name, d[9].name_len, "else") && d[9].depth == 1 && d[9].args_len == 0, "else");
+  expect(span_is(d[10].name, d[10].name_len, "endif") && d[10].depth == 1, "inner endif");
+  expect(span_is(d[11].name, d[11].name_len, "endif") && d[11].depth == 0, "outer endif");
+  expect(span_is(d[12].args, d[12].args_len, "a//b.h") && d[12].include_kind == '<', "comment characters in a path");
+  expect(span_is(d[13].args, d[13].args_len, "after_comment.h") && d[13].include_kind == '"',
+         "include after a comment");
+  expect(span_is(d[14].args, d[14].args_len, "after_comments.h") && d[14].include_kind == '<',
+         "include after a multi-line comment and another");
+  expect(span_is(d[15].name, d[15].name_len, "pragma") && span_is(d[15].args, d[15].args_len, "once"),
+         "directive on the last line without a newline");
+  expect(sc.depth == 0, "balanced conditionals");
+
+  expect(!slex_next_directive(&sc, &d[0]), "end of the stream");
+}
+
+// The scanner has to find the same directives as a full lex of sample.c: # tokens that are
+// the first token on their line, with only whitespace and comments before them.
+static void test_sample(char *text, size_t len) {
+  SlexContext ctx;
+  SlexDirectiveScanner sc;
+  SlexDirective d;
+  char store[1024];
+  int same = 1;
+  size_t found = 0;
+
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  slex_init_directive_scanner(&sc, text, text + len);
+  char *prev_end = NULL;
+  for (;;) {
+    if (!slex_get_next_token(&ctx)) {
+      if (ctx.parse_point >= ctx.stream_end) break;
+      ctx.parse_point++;
+      prev_end = ctx.parse_point;
+      continue;
+    }
+    if (ctx.tok_ty == SLEX_TOK_eof) break;
+    char *gap = prev_end;
+    prev_end = ctx.parse_point;
+    if (ctx.tok_ty != SLEX_TOK_preprocessor || (gap && !slex_gap_breaks_line(gap, ctx.first_tok_char))) continue;
+    if (!slex_get_next_token(&ctx) || ctx.tok_ty != SLEX_TOK_identifier) continue;
+    prev_end = ctx.parse_point;
+
+    found++;
+    same &= slex_next_directive(&sc, &d) && d.name == ctx.first_tok_char &&
+      d.name_len == (size_t)(ctx.last_tok_char - ctx.first_tok_char + 1);
+  }
+  expect(found > 0 && same && !slex_next_directive(&sc, &d), "same directives as a full lex of sample.c");
+}
+
+int main(void) {
+  FILE *file = fopen(TESTFILE, "rb");
+  if (!file) {
+    printf("- FAILED: cannot open %s\n", TESTFILE);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) {
+    printf("- FAILED: cannot read %s\n", TESTFILE);
+    return 1;
+  }
+  fclose(file);
+
+  test_source();
+  test_sample(text, len);
+  free(text);
+
+  if (failures) return 1;
+  printf("+ All directive scanner tests passed\n");
+  return 0;
+}
@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+// Fingerprints of a whole buffer, out_cap at a time.
+static size_t fingerprint(char *text, size_t len, size_t k, size_t window, size_t out_cap, SlexFingerprint *all) {
+  SlexContext ctx;
+  SlexFingerprinter fp;
+  SlexFingerprint out[512];
+  char store[1024];
+  size_t count = 0;
+
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  slex_init_fingerprinter(&fp, text, k, window);
+  for (;;) {
+    size_t out_len;
+    int done = slex_fingerprint(&ctx, &fp, out, out_cap, &out_len);
+    memcpy(all + count, out, out_len * sizeof(SlexFingerprint));
+    count += out_len;
+    if (done) break;
+    if (ctx.tok_ty != SLEX_ERR_storage) {
+      expect(0, "slex_fingerprint only stops when out is full");
+      break;
+    }
+  }
+  return count;
+}
+
+// The textbook version: tokenize, normalize, hash every k-gram and winnow.
+static size_t reference(char *text, size_t len, size_t k, size_t window, SlexFingerprint *out) {
+  SlexContext ctx;
+  char store[1024];
+  size_t n = 0;
+  slex_u64 *values = (slex_u64 *)malloc((len + 1) * sizeof(slex_u64));
+  size_t *offsets = (size_t *)malloc((len + 1) * sizeof(size_t));
+
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  for (;;) {
+    if (!slex_get_next_token(&ctx)) {
+      if (ctx.parse_point >= ctx.stream_end) break;
+      ctx.parse_point++;
+      continue;
+    }
+    if (ctx.tok_ty == SLEX_TOK_eof) break;
+    int norm = ctx.tok_ty;
+    if (norm == SLEX_TOK_str_lit || norm == SLEX_TOK_char_lit || norm == SLEX_TOK_float_lit)
+      norm = SLEX_TOK_int_lit;
+    values[n] = ((slex_u64)norm + 1) * 0x9E3779B97F4A7C15ull;
+    offsets[n] = (size_t)(ctx.first_tok_char - text);
+    n++;
+  }
+
+  size_t grams = n >= k ? n - k + 1 : 0;
+  slex_u64 *hashes = (slex_u64 *)malloc((grams + 1) * sizeof(slex_u64));
+  for (size_t g = 0; g < grams; g++) {
+    slex_u64 h = 0;
+    for (size_t i = 0; i < k; i++)
+      h = h * SLEX_FINGERPRINT_BASE + values[g + i];
+    hashes[g] = h;
+  }
+
+  size_t count = 0;
+  size_t last = (size_t)-1;
+  size_t windows = grams >= window ? grams - window + 1 : grams > 0;
+  size_t width = grams >= window ? window : grams;
+  for (size_t w = 0; w < windows; w++) {
+    size_t pick = w;
+    for (size_t i = w; i < w + width; i++)
+      if (hashes[i] <= hashes[pick]) pick = i;
+    if (pick == last) continue;
+    last = pick;
+    out[count].hash = hashes[pick];
+    out[count].offset = offsets[pick];
+    count++;
+  }
+
+  free(hashes);
+  free(offsets);
+  free(values);
+  return count;
+}
+
+static int same_fingerprints(const SlexFingerprint *a, size_t a_len, const SlexFingerprint *b, size_t b_len, int check_offsets) {
+  if (a_len != b_len) return 0;
+  for (size_t i = 0; i < a_len; i++) {
+    if (a[i].hash != b[i].hash) return 0;
+    if (check_offsets && a[i].offset != b[i].offset) return 0;
+  }
+  return 1;
+}
+
+static void test_sample(char *text, size_t len) {
+  SlexFingerprint *got = (SlexFingerprint *)malloc((len + 1) * sizeof(SlexFingerprint));
+  SlexFingerprint *expected = (SlexFingerprint *)malloc((len + 1) * sizeof(SlexFingerprint));
+  size_t ks[] = {1, 3, 5, 12};
+  size_t windows[] = {1, 4, 8, 64};
+
+  for (size_t i = 0; i < 4; i++) {
+    for (size_t j = 0; j < 4; j++) {
+      size_t expected_len = reference(text, len, ks[i], windows[j], expected);
+      size_t got_len = fingerprint(text, len, ks[i], windows[j], 512, got);
+      expect(same_fingerprints(got, got_len, expected, expected_len, 1), "fingerprints of sample.c match the two pass version");
+
+      // resuming with a tiny buffer changes nothing
+      got_len = fingerprint(text, len, ks[i], windows[j], 1, got);
+      expect(same_fingerprints(got, got_len, expected, expected_len, 1), "fingerprints with a one entry buffer");
+    }
+  }
+  expect(fingerprint(text, len, 5, 4, 512, got) > 20, "sample.c has fingerprints");
+
+  free(expected);
+  free(got);
+}
+
+// Renaming identifiers and changing literals or layout keeps the fingerprints.
+static void test_renamed(void) {
+  char a[] = "int sum(int *xs, int n) { int s = 0; for (int i = 0; i < n; i++) s += xs[i]; return s; }";
+  char b[] = "long total(long*v,long len){/* sum */long acc=1.5;\nfor(long j=0;j<len;j++)acc+=v[j];return acc;}";
+  char c[] = "int sum(int *xs, int n) { int s = 0; while (n--) s += xs[n]; return s; }";
+  SlexFingerprint fa[128];
+  SlexFingerprint fb[128];
+  SlexFingerprint fc[128];
+
+  size_t la = fingerprint(a, strlen(a), 4, 4, 128, fa);
+  size_t lb = fingerprint(b, strlen(b), 4, 4, 128, fb);
+  size_t lc = fingerprint(c, strlen(c), 4, 4, 128, fc);
+  expect(la > 0 && same_fingerprints(fa, la, fb, lb, 0), "renamed copy has the same fingerprints");
+  expect(!same_fingerprints(fa, la, fc, lc, 0), "different code has different fingerprints");
+  expect(fb[0].offset < strlen(b), "offsets point into the input");
+
+  // shorter than a window: one fingerprint
+  char d[] = "a = b;";
+  expect(fingerprint(d, strlen(d), 2, 8, 128, fa) == 1, "short input gets one fingerprint");
+  expect(fingerprint(d, 0, 2, 8, 128, fa) == 0, "empty input has no fingerprints");
+}
+
+int main(void) {
+  FILE *file = fopen(TESTFILE, "rb");
+  if (!file) {
+    printf("- FAILED: cannot open %s\n", TESTFILE);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) {
+    printf("- FAILED: cannot read %s\n", TESTFILE);
+    return 1;
+  }
+  fclose(file);
+
+  test_sample(text, len);
+  test_renamed();
+  free(text);
+
+  if (failures) return 1;
+  printf("+ All fingerprint tests passed\n");
+  return 0;
+}
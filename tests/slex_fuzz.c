@@ -2,13 +2,49 @@
 #define SLEX_IMPLEMENTATION
 #include "../src/slex.h"
 
+#define SLEX_PREFIX slex_padded_
+#define SLEX_PADDED_INPUT 1
+#include "../src/slex.h"
+
 // for better performance
 #define ENABLE_SILENT_FUZZING 1
 
 #include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 char store[1024];
+char padded_store[1024];
+
+// The padded instance reads past stream_end, so it only gets a copy with exactly
+// SLEX_PADDING bytes after the input; it has to agree with the default instance.
+static void fuzz_padded(const uint8_t *Data, size_t Size) {
+  char *padded = (char *)malloc(Size + SLEX_PADDING);
+  memcpy(padded, Data, Size);
+  memset(padded + Size, 0, SLEX_PADDING);
+
+  SlexContext ctx;
+  SlexContext pctx;
+  slex_init_context(&ctx, (char *)Data, (char *)Data + Size, store, 1024);
+  slex_init_context(&pctx, padded, padded + Size, padded_store, 1024);
+  for (;;) {
+    int ok = slex_get_next_token(&ctx);
+    int padded_ok = slex_padded_get_next_token(&pctx);
+    if (ok != padded_ok || ctx.tok_ty != pctx.tok_ty ||
+        ctx.parse_point - (char *)Data != pctx.parse_point - padded)
+      abort();
+    if (!ok) {
+      if (ctx.parse_point >= ctx.stream_end) break;
+      ctx.parse_point++;
+      pctx.parse_point++;
+      continue;
+    }
+    if (ctx.tok_ty == SLEX_TOK_eof)
+      break;
+  }
+  free(padded);
+}
 
 int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
   SlexContext ctx;
@@ -17,10 +53,10 @@ int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
   for (;;) {
     if (!slex_get_next_token(&ctx)) {
 #if !(ENABLE_SILENT_FUZZING)
-      int ln;
-      int col;
+      size_t ln;
+      size_t col;
       slex_get_parse_ptr_location(&ctx, (char *)Data, &ln, &col);
-      printf("- An error occured at %d:%d\n", ln, col);
+      printf("- An error occured at %zu:%zu\n", ln, col);
 #endif
       ctx.parse_point++;
       continue;
@@ -34,7 +70,7 @@ int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
     printf("+ Parsed token: %.*s\n", len, ctx.first_tok_char);
 
     if (ctx.tok_ty == SLEX_TOK_str_lit || ctx.tok_ty == SLEX_TOK_char_lit)
-      printf("    Extracted string or char: %.*s\n", ctx.str_len,
+      printf("    Extracted string or char: %.*s\n", (int)ctx.str_len,
              ctx.string_store);
 
     else if (ctx.tok_ty == SLEX_TOK_int_lit)
@@ -44,5 +80,6 @@ int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
       printf("    Extracted float literal: %f\n", ctx.parsed_float_lit);
 #endif
   }
+  fuzz_padded(Data, Size);
   return 0;
 }
@@ -0,0 +1,47 @@
+#include <stdio.h>
+#include <string.h>
+
+#define SLEX_IMPLEMENTATION
+
+#define SLEX_PREFIX slex_c_
+#define SLEX_CXX_SUPPORT 0
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_cxx_
+#define SLEX_CXX_SUPPORT 1
+#include "../src/slex.h"
+
+// The default instance can live next to the prefixed ones.
+#include "../src/slex.h"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+int main(void) {
+  char text[] = "a::b";
+  char store[64];
+  SlexContext ctx;
+
+  slex_c_init_context(&ctx, text, text + strlen(text), store, 64);
+  expect(slex_c_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_identifier, "c: identifier");
+  expect(slex_c_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_colon, "c: colon");
+  expect(slex_c_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_colon, "c: second colon");
+
+  slex_cxx_init_context(&ctx, text, text + strlen(text), store, 64);
+  expect(slex_cxx_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_identifier, "cxx: identifier");
+  expect(slex_cxx_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_scope_resolution, "cxx: scope resolution");
+
+  slex_init_context(&ctx, text, text + strlen(text), store, 64);
+  expect(slex_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_identifier, "default: identifier");
+  expect(slex_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_scope_resolution, "default: scope resolution");
+
+  if (failures) return 1;
+  printf("+ All instance tests passed\n");
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+// Synthesizes an input larger than 4 GB without using 4 GB of memory: one block file is
+// mapped over and over into a reserved address range, between a head and a tail page.
+#define BLOCKFILE "build/large_block.bin"
+#define PAGE 4096
+#define BLOCK ((size_t)1 << 20)
+#define BLOCKS ((size_t)4100)
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+static char *map_input(char fill, const char *head, const char *tail, size_t *len) {
+  char *block = (char *)malloc(BLOCK);
+  memset(block, fill, BLOCK);
+  FILE *f = fopen(BLOCKFILE, "wb");
+  if (!f || fwrite(block, 1, BLOCK, f) != BLOCK) {
+    free(block);
+    return NULL;
+  }
+  fclose(f);
+  free(block);
+
+  *len = PAGE + BLOCKS * BLOCK + PAGE;
+  char *text = (char *)mmap(NULL, *len, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (text == MAP_FAILED) return NULL;
+
+  int fd = open(BLOCKFILE, O_RDONLY);
+  for (size_t i = 0; i < BLOCKS; i++)
+    mmap(text + PAGE + i * BLOCK, BLOCK, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+  close(fd);
+
+  mprotect(text, PAGE, PROT_READ | PROT_WRITE);
+  mprotect(text + PAGE + BLOCKS * BLOCK, PAGE, PROT_READ | PROT_WRITE);
+  memset(text, fill, PAGE);
+  memset(text + PAGE + BLOCKS * BLOCK, fill, PAGE);
+  memcpy(text, head, strlen(head));
+  memcpy(text + PAGE + BLOCKS * BLOCK, tail, strlen(tail));
+  return text;
+}
+
+int main(void) {
+  SlexContext ctx;
+  char store[64];
+  size_t len;
+  size_t ln;
+  size_t col;
+  size_t tail_offset = PAGE + BLOCKS * BLOCK;
+
+  // one line longer than 4 GB
+  char *text = map_input(' ', "{", "} x", &len);
+  if (!text) {
+    fprintf(stderr, "Error mapping input\n");
+    return 1;
+  }
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  expect(slex_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_l_brace, "opening brace");
+  expect(slex_skip_balanced(&ctx) && (size_t)(ctx.last_tok_char - text) == tail_offset,
+         "balanced region longer than 4 GB");
+  expect(slex_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_identifier, "identifier after 4 GB");
+  slex_get_token_location(&ctx, text, &ln, &col);
+  expect(ln == 1 && col == tail_offset + 3, "column past 4 GB");
+  expect(slex_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_eof, "eof");
+  munmap(text, len);
+
+  // more than 4 G lines
+  text = map_input('\n', "", "x", &len);
+  if (!text) {
+    fprintf(stderr, "Error mapping input\n");
+    return 1;
+  }
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  expect(slex_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_identifier, "identifier after 4 G lines");
+  slex_get_token_location(&ctx, text, &ln, &col);
+  expect(ln == tail_offset + 1 && col == 1, "line past 4 G");
+  munmap(text, len);
+
+  unlink(BLOCKFILE);
+  if (failures) return 1;
+  printf("+ All large input tests passed\n");
+  return 0;
+}
@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_lazy_
+#define SLEX_LAZY_LITERALS 1
+#include "../src/slex.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+// The lazy lexer has to produce the same tokens, and decoding a stored token
+// has to give the values the eager lexer computed.
+static void compare(char *text, int len) {
+  SlexContext eager;
+  SlexContext lazy;
+  char eager_store[1024];
+  char lazy_store[1024];
+
+  slex_init_context(&eager, text, text + len, eager_store, 1024);
+  slex_lazy_init_context(&lazy, text, text + len, lazy_store, 1024);
+  for (;;) {
+    int ok = slex_get_next_token(&eager);
+    int lazy_ok = slex_lazy_get_next_token(&lazy);
+
+    expect(ok == lazy_ok && eager.tok_ty == lazy.tok_ty, "same token type");
+    expect(eager.parse_point == lazy.parse_point, "same parse point");
+    if (!ok) {
+      if (eager.tok_ty != lazy.tok_ty) return;
+      eager.parse_point++;
+      lazy.parse_point++;
+      continue;
+    }
+    expect(eager.first_tok_char == lazy.first_tok_char &&
+           eager.last_tok_char == lazy.last_tok_char, "same token span");
+    if (eager.tok_ty == SLEX_TOK_eof)
+      break;
+
+    SlexToken tok = {lazy.tok_ty, lazy.first_tok_char, lazy.last_tok_char};
+    if (tok.tok_ty == SLEX_TOK_int_lit) {
+      unsigned long long value;
+      expect(slex_lazy_token_int_value(&tok, &value) && value == eager.parsed_int_lit,
+             "int value");
+    } else if (tok.tok_ty == SLEX_TOK_float_lit) {
+      double value;
+      expect(slex_lazy_token_float_value(&tok, &value) && value == eager.parsed_float_lit,
+             "float value");
+    } else if (tok.tok_ty == SLEX_TOK_str_lit || tok.tok_ty == SLEX_TOK_char_lit) {
+      size_t str_len;
+      expect(slex_lazy_token_decode_string(&tok, lazy_store, 1024, &str_len) &&
+             str_len == eager.str_len && memcmp(lazy_store, eager_store, str_len) == 0,
+             "decoded string");
+    }
+  }
+}
+
+int main(void) {
+  FILE *f = fopen(TESTFILE, "rb");
+  char *text = (char *)malloc(1 << 20);
+  int len = f ? (int)fread(text, 1, 1 << 20, f) : -1;
+
+  if (len < 0) {
+    fprintf(stderr, "Error opening file\n");
+    free(text);
+    return 1;
+  }
+
+  fclose(f);
+  compare(text, len);
+
+  char numbers[] = "0 0x 0x1F 0b101 07 08 1.5 2e3 0.e-2 1e 3ul 0x1.8 1x 0b \"\\x4\" 'a' \"\\u00e9\"";
+  compare(numbers, (int)strlen(numbers));
+
+  // Value errors are reported when decoding.
+  char big[] = "99999999999999999999";
+  SlexContext ctx;
+  char store[4];
+  unsigned long long value;
+  slex_lazy_init_context(&ctx, big, big + strlen(big), store, 4);
+  expect(slex_lazy_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_int_lit, "big int delimited");
+  SlexToken tok = {ctx.tok_ty, ctx.first_tok_char, ctx.last_tok_char};
+  expect(!slex_lazy_token_int_value(&tok, &value), "big int does not fit");
+
+  free(text);
+  if (failures) return 1;
+  printf("+ All lazy literal tests passed\n");
+  return 0;
+}
@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_trivia_
+#define SLEX_EMIT_TRIVIA 1
+#include "../src/slex.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+typedef struct {
+  int tok_ty;
+  char *text;
+  size_t len;
+} Tok;
+
+// The tokens up to the first error (or the end).
+static size_t lex_all(char *text, size_t len, Tok *out) {
+  SlexContext ctx;
+  char store[4096];
+  size_t n = 0;
+
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  while (slex_get_next_token(&ctx) && ctx.tok_ty != SLEX_TOK_eof) {
+    out[n].tok_ty = ctx.tok_ty;
+    out[n].text = ctx.first_tok_char;
+    out[n].len = (size_t)(ctx.last_tok_char - ctx.first_tok_char + 1);
+    n++;
+  }
+  return n;
+}
+
+// Minifies text and lexes the output again: it has the tokens of the input (up to the
+// input's first error) and isn't longer.
+static int check(char *text, size_t len, int keep_lines, int (*minify)(SlexContext *, char *, size_t, int, size_t *)) {
+  Tok *expected = (Tok *)malloc((len + 1) * sizeof(Tok));
+  Tok *got = (Tok *)malloc((len + 1) * sizeof(Tok));
+  // exactly the input's size, so the sanitizer catches writes past it
+  char *out = (char *)malloc(len + 1);
+  size_t expected_len = lex_all(text, len, expected);
+
+  SlexContext ctx;
+  char store[4096];
+  size_t out_len = 0;
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  int done = minify(&ctx, out, len, keep_lines, &out_len);
+
+  int same = (done || ctx.tok_ty != SLEX_ERR_storage) && out_len <= len;
+  size_t got_len = same ? lex_all(out, out_len, got) : 0;
+  same &= got_len == expected_len;
+  for (size_t i = 0; i < got_len && same; i++)
+    same = got[i].tok_ty == expected[i].tok_ty && got[i].len == expected[i].len &&
+      memcmp(got[i].text, expected[i].text, got[i].len) == 0;
+
+  free(out);
+  free(got);
+  free(expected);
+  return same;
+}
+
+static int check_all(char *text, size_t len) {
+  return check(text, len, 0, slex_minify) && check(text, len, 1, slex_minify) &&
+    check(text, len, 1, slex_trivia_minify);
+}
+
+static void expect_minified(const char *text, int keep_lines, const char *expected) {
+  SlexContext ctx;
+  char store[256];
+  char out[256];
+  size_t out_len = 0;
+
+  slex_init_context(&ctx, (char *)text, (char *)text + strlen(text), store, sizeof(store));
+  int done = slex_minify(&ctx, out, sizeof(out), keep_lines, &out_len);
+  if (!done || out_len != strlen(expected) || memcmp(out, expected, out_len) != 0) {
+    printf("  got \"%.*s\", expected \"%s\"\n", (int)out_len, out, expected);
+    expect(0, "minified as expected");
+  }
+}
+
+static void test_cases(void) {
+  const char *program =
+    "#include <stdio.h>\n"
+    "/* a\n comment */ int  main ( void ) {\n"
+    "  return 0; // done\n"
+    "}\n";
+  expect_minified(program, 0, "#include<stdio.h>int main(void){return 0;}");
+  expect_minified(program, 1, "#include<stdio.h>\nint main(void){return 0;}");
+
+  // only what would run together is kept apart
+  expect_minified("a + +b; a - -b; a+ ++b; x . y; 1 .5; . 5; 1e5 + 1; 0x1e + 1; 0x1p - 3", 0,
+                  "a+ +b;a- -b;a+ ++b;x.y;1 .5;. 5;1e5+1;0x1e +1;0x1p -3");
+  expect_minified("a / *p; a / / b; a < <= b; . . .; . .. ; :: :", 0, "a/ *p;a/ /b;a< <=b;.. .;.. .;:::");
+  expect_minified("L \"s\"; L\"s\"; \"s\" _x; 'a' 'b'", 0, "L \"s\";L\"s\";\"s\" _x;'a''b'");
+
+  // directives keep their lines, and a comment spanning lines doesn't end one
+  expect_minified("x;\n  #  define F( x ) ( x )\n#define N (1)\n#define M(1)\n#if /* a\n b */ N\ny\n#endif\n", 1,
+                  "x;\n#define F(x)(x)\n#define N (1)\n#define M(1)\n#if N\ny\n#endif\n");
+  // a line splice stays, with the space around it
+  expect_minified("#define S \\\n  \"s\"\n#define T(x)\\\nx\nL\\\n\"s\" L \\\n\"s\"\n", 1,
+                  "#define S \\\n\"s\"\n#define T(x)\\\nx\nL\\\n\"s\" L \\\n\"s\"");
+  // without the option everything is on one line
+  expect_minified("#define A 1\n#define B 2\n", 0, "#define A 1#define B 2");
+  expect_minified("#endif", 1, "#endif");
+  expect_minified("", 1, "");
+}
+
+static void test_errors(void) {
+  SlexContext ctx;
+  char store[64];
+  char out[64];
+  size_t out_len;
+
+  char text[] = "a = 1; /* unterminated";
+  slex_init_context(&ctx, text, text + strlen(text), store, sizeof(store));
+  expect(!slex_minify(&ctx, out, sizeof(out), 0, &out_len) && ctx.tok_ty == SLEX_ERR_parse &&
+         out_len == 4 && memcmp(out, "a=1;", 4) == 0, "an error stops the minifier after the tokens before it");
+
+  char long_text[] = "int value = 1;";
+  slex_init_context(&ctx, long_text, long_text + strlen(long_text), store, sizeof(store));
+  expect(!slex_minify(&ctx, out, 7, 0, &out_len) && ctx.tok_ty == SLEX_ERR_storage && out_len == 3,
+         "a full buffer stops the minifier");
+}
+
+static unsigned long long seed = 0x9e3779b97f4a7c15ull;
+
+static unsigned random_below(unsigned n) {
+  seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+  return (unsigned)(seed >> 33) % n;
+}
+
+// Pieces that run together in many ways.
+static const char *fragments[] = {
+  "a", "L", "u8", "e", "_1", "1", "0x1e", "1e", "1.", ".5", "0x1p", "'a'", "\"s\"", "\xc3\xa9",
+  ".", "+", "-", "*", "/", "%", "&", "|", "^", "<", ">", "=", "!", ":", "#", "(", ")", ";", "\\",
+  " ", " ", "\t", "\n", "\n", "/* c */", "/*\n*/", "// c\n", "\\\n", "\\\r\n",
+};
+
+static void test_random_sources(void) {
+  char buf[256];
+
+  for (int round = 0; round < 20000; round++) {
+    size_t len = 0;
+    int pieces = 1 + (int)random_below(32);
+    for (int i = 0; i < pieces; i++) {
+      const char *frag = fragments[random_below(sizeof(fragments) / sizeof(*fragments))];
+      size_t frag_len = strlen(frag);
+      if (len + frag_len > sizeof(buf)) break;
+      memcpy(buf + len, frag, frag_len);
+      len += frag_len;
+    }
+    if (!check_all(buf, len)) {
+      printf("  %.*s\n", (int)len, buf);
+      expect(0, "random source minifies to the same tokens");
+      return;
+    }
+  }
+}
+
+int main(void) {
+  FILE *file = fopen(TESTFILE, "rb");
+  if (!file) {
+    printf("- FAILED: cannot open %s\n", TESTFILE);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) {
+    printf("- FAILED: cannot read %s\n", TESTFILE);
+    return 1;
+  }
+  fclose(file);
+
+  expect(check_all(text, len), "sample.c minifies to the same tokens");
+  test_cases();
+  test_errors();
+  test_random_sources();
+  free(text);
+
+  if (failures) return 1;
+  printf("+ All minifier tests passed\n");
+  return 0;
+}
@@ -0,0 +1,183 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_padded_
+#define SLEX_PADDED_INPUT 1
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_trivia_
+#define SLEX_EMIT_TRIVIA 1
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_padded_trivia_
+#define SLEX_EMIT_TRIVIA 1
+#define SLEX_PADDED_INPUT 1
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_lazy_
+#define SLEX_LAZY_LITERALS 1
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_padded_lazy_
+#define SLEX_LAZY_LITERALS 1
+#define SLEX_PADDED_INPUT 1
+#include "../src/slex.h"
+
+#define SLEX_PIPELINE_IMPLEMENTATION
+#include "../src/slex_pipeline.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+typedef int (*GetNextToken)(SlexContext *ctx);
+
+// A padded and an unpadded instance have to give the same tokens, values and errors.
+static int compare(char *text, size_t len, GetNextToken get, GetNextToken get_padded) {
+  // malloc'ed so the sanitizer catches reads past the padding
+  char *padded = (char *)malloc(len + SLEX_PADDING);
+  memcpy(padded, text, len);
+  memset(padded + len, 0, SLEX_PADDING);
+
+  SlexContext ctx;
+  SlexContext pctx;
+  char store[64];
+  char padded_store[64];
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  slex_init_context(&pctx, padded, padded + len, padded_store, sizeof(padded_store));
+
+  int same = 1;
+  for (;;) {
+    int ok = get(&ctx);
+    int padded_ok = get_padded(&pctx);
+    if (ok != padded_ok || ctx.tok_ty != pctx.tok_ty ||
+        ctx.parse_point - text != pctx.parse_point - padded ||
+        ctx.last_tok_char - text != pctx.last_tok_char - padded) {
+      same = 0;
+      break;
+    }
+    if (!ok) {
+      if (ctx.parse_point >= ctx.stream_end) break;
+      ctx.parse_point++;
+      pctx.parse_point++;
+      continue;
+    }
+    if (ctx.tok_ty == SLEX_TOK_eof) break;
+    if (ctx.first_tok_char - text != pctx.first_tok_char - padded ||
+        (ctx.tok_ty == SLEX_TOK_int_lit && ctx.parsed_int_lit != pctx.parsed_int_lit) ||
+        (ctx.tok_ty == SLEX_TOK_float_lit &&
+         memcmp(&ctx.parsed_float_lit, &pctx.parsed_float_lit, sizeof(double)) != 0)) {
+      same = 0;
+      break;
+    }
+  }
+  free(padded);
+  return same;
+}
+
+static int compare_all(char *text, size_t len) {
+  return compare(text, len, slex_get_next_token, slex_padded_get_next_token) &&
+    compare(text, len, slex_trivia_get_next_token, slex_padded_trivia_get_next_token) &&
+    compare(text, len, slex_lazy_get_next_token, slex_padded_lazy_get_next_token);
+}
+
+static unsigned long long seed = 0x9e3779b97f4a7c15ull;
+
+static unsigned random_below(unsigned n) {
+  seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+  return (unsigned)(seed >> 33) % n;
+}
+
+// Pieces that end tokens right at stream_end, and '\0' inside the input.
+static const char *fragments[] = {
+  "/*", "*/", "*", "/", "//", "\n", "\\", "\"", "'", "0", "0x", "0b", "07", "1.", "1.5e", "e+",
+  "3", "u", "ULL", "a", "_b9", "<", "<<", "=", ">", "-", ".", "..", "#", ":", "&", "|", " ",
+  "\t", "\r\n", "", "\xff",
+};
+
+static void test_random_sources(void) {
+  char buf[256];
+
+  for (int round = 0; round < 20000; round++) {
+    size_t len = 0;
+    int pieces = 1 + (int)random_below(24);
+    for (int i = 0; i < pieces; i++) {
+      int pick = (int)random_below(sizeof(fragments) / sizeof(*fragments) + 1);
+      const char *frag = pick < (int)(sizeof(fragments) / sizeof(*fragments)) ? fragments[pick] : NULL;
+      size_t frag_len = frag ? strlen(frag) : 1;
+      if (len + frag_len > sizeof(buf)) break;
+      if (frag) memcpy(buf + len, frag, frag_len);
+      else buf[len] = '\0';
+      len += frag_len;
+    }
+    if (!compare_all(buf, len)) {
+      expect(0, "random source lexes the same padded and unpadded");
+      return;
+    }
+  }
+}
+
+// slex_map_file leaves SLEX_PADDING zero bytes after the text.
+static void test_map_file(char *text, size_t len) {
+  size_t mapped_len = 0;
+  char *mapped = slex_map_file(TESTFILE, &mapped_len);
+  expect(mapped && mapped_len == len && memcmp(mapped, text, len) == 0, "mapped file has the file's text");
+  if (!mapped) return;
+
+  int zero = 1;
+  for (size_t i = 0; i < SLEX_PADDING; i++) zero &= mapped[mapped_len + i] == 0;
+  expect(zero, "mapped file is followed by zero padding");
+
+  SlexContext ctx;
+  char store[1024];
+  size_t tokens = 0;
+  slex_init_context(&ctx, mapped, mapped + mapped_len, store, sizeof(store));
+  while (slex_padded_get_next_token(&ctx) && ctx.tok_ty != SLEX_TOK_eof) tokens++;
+  expect(ctx.tok_ty == SLEX_TOK_eof && tokens > 100, "padded instance lexes the mapped file");
+  slex_unmap_file(mapped, mapped_len);
+
+  expect(slex_map_file("does/not/exist.c", &mapped_len) == NULL, "missing file can't be mapped");
+}
+
+int main(void) {
+  FILE *file = fopen(TESTFILE, "rb");
+  if (!file) {
+    printf("- FAILED: cannot open %s\n", TESTFILE);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) {
+    printf("- FAILED: cannot read %s\n", TESTFILE);
+    return 1;
+  }
+  fclose(file);
+
+  expect(compare_all(text, len), "sample.c lexes the same padded and unpadded");
+  // every prefix, so the input ends in every possible place
+  for (size_t i = 0; i <= len; i++) {
+    if (!compare_all(text, i)) {
+      expect(0, "prefix of sample.c lexes the same padded and unpadded");
+      break;
+    }
+  }
+  test_random_sources();
+  test_map_file(text, len);
+  free(text);
+
+  if (failures) return 1;
+  printf("+ All padded input tests passed\n");
+  return 0;
+}
@@ -0,0 +1,259 @@
+// Performance regression fuzzer: finds inputs on which the work of the lexer grows faster
+// than the input.
+//
+// The work is the step counter of the lexer (SLEX_COUNT_STEPS) plus the bytes walked to
+// locate the errors, both for the whole input at once and for the input fed in small
+// chunks as a partial stream, plus the budget spent lexing it with a small budget per call
+// and the steps of the lexer in slex_search_next looking for a few short names in it.
+// An input x is repeated into a stream of at least MIN_SMALL
+// bytes and at least two copies (so tokens spanning the copies show up), and flagged when
+// GROWTH times that stream costs clearly more than GROWTH times as much.
+//
+// As a libFuzzer target (make perf-fuzz) a flagged input aborts, so libFuzzer saves it.
+// Built with SLEX_PERF_STANDALONE it checks the files given on the command line (the
+// slow_corpus/ regression set), or with -random N DIR tries N random inputs and saves the
+// flagged ones into DIR.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SLEX_COUNT_STEPS 1
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+static slex_u64 search_steps;
+
+// The lexer of the search, counting its steps (its contexts are its own).
+static int search_get_next_token(SlexContext *ctx) {
+  slex_u64 steps = ctx->steps;
+  int res = slex_get_next_token(ctx);
+  search_steps += ctx->steps - steps;
+  return res;
+}
+
+#define SLEX_PIPELINE_IMPLEMENTATION
+#include "../src/slex_pipeline.h"
+
+#define SLEX_SEARCH_IMPLEMENTATION
+#define SLEX_SEARCH_GET_NEXT_TOKEN search_get_next_token
+#include "../src/slex_search.h"
+
+#define GROWTH 8
+#define MIN_SMALL (16 * FEED_CHUNK)
+#define FEED_CHUNK 64
+#define BUDGET 256
+
+static char store[1024];
+
+// Lexes data like a compiler would (skipping a character after an error and locating every
+// error) and returns the work done.
+static slex_u64 cost_whole(char *data, size_t size) {
+  SlexContext ctx;
+  SlexLocation loc;
+  slex_u64 walked = 0;
+
+  slex_init_context(&ctx, data, data + size, store, sizeof(store));
+  slex_init_location(&loc, data);
+  for (;;) {
+    if (slex_get_next_token(&ctx)) {
+      if (ctx.tok_ty == SLEX_TOK_eof) break;
+      continue;
+    }
+    if (ctx.parse_point >= ctx.stream_end) break;
+
+    size_t ln;
+    size_t col;
+    walked += (slex_u64)(ctx.parse_point - (ctx.parse_point < loc.pos ? data : loc.pos));
+    slex_get_location(&loc, ctx.parse_point, &ln, &col);
+    ctx.parse_point++;
+  }
+  return ctx.steps + walked;
+}
+
+// Lexes data as a partial stream that grows by FEED_CHUNK bytes, or by the held back tail
+// when that is longer (the policy of slex_pipeline_refill), and returns the work done.
+static slex_u64 cost_fed(char *data, size_t size) {
+  SlexContext ctx;
+  size_t avail = size < FEED_CHUNK ? size : FEED_CHUNK;
+
+  slex_init_context(&ctx, data, data + avail, store, sizeof(store));
+  ctx.stream_is_partial = avail < size;
+  for (;;) {
+    if (slex_get_next_token(&ctx)) {
+      if (ctx.tok_ty == SLEX_TOK_eof) break;
+      continue;
+    }
+    if (ctx.tok_ty == SLEX_ERR_need_input) {
+      size_t tail = (size_t)(ctx.stream_end - ctx.parse_point);
+      avail += tail > FEED_CHUNK ? tail : FEED_CHUNK;
+      if (avail >= size) avail = size;
+      ctx.stream_end = data + avail;
+      ctx.stream_is_partial = avail < size;
+      continue;
+    }
+    if (ctx.parse_point >= ctx.stream_end) break;
+    ctx.parse_point++;
+  }
+  return ctx.steps;
+}
+
+// Lexes data with slex_get_next_token_budgeted and a budget of BUDGET bytes for each call,
+// and returns the budget spent.
+static slex_u64 cost_budgeted(char *data, size_t size) {
+  SlexContext ctx;
+  slex_u64 spent = 0;
+
+  slex_init_context(&ctx, data, data + size, store, sizeof(store));
+  for (;;) {
+    size_t budget = BUDGET;
+    int ok = slex_get_next_token_budgeted(&ctx, &budget);
+    spent += BUDGET - budget;
+    if (ok) {
+      if (ctx.tok_ty == SLEX_TOK_eof) break;
+      continue;
+    }
+    if (ctx.tok_ty == SLEX_ERR_would_block) continue;
+    if (ctx.parse_point >= ctx.stream_end) break;
+    ctx.parse_point++;
+  }
+  return spent;
+}
+
+// Searches data for a few names and returns the steps of the lexer plus the hits.
+static slex_u64 cost_search(char *data, size_t size) {
+  static const char *const names[] = {"a", "e", "x", "L"};
+  slex_u64 hits = 0;
+
+  search_steps = 0;
+  for (size_t i = 0; i < sizeof(names) / sizeof(*names); i++) {
+    SlexSearch search;
+    slex_search_init(&search, data, data + size, names[i], 1);
+    while (slex_search_next(&search)) hits++;
+  }
+  return search_steps + hits;
+}
+
+static slex_u64 cost(char *data, size_t size) {
+  return cost_whole(data, size) + cost_fed(data, size) + cost_budgeted(data, size) + cost_search(data, size);
+}
+
+// Returns 1 if the cost of data grows super-linearly when it is repeated.
+static int check(const char *data, size_t size, double *steps_per_byte) {
+  size_t copies = size ? (MIN_SMALL + size - 1) / size : 1;
+  if (copies < 2) copies = 2;
+  size_t small_size = size * copies;
+  size_t large_size = small_size * GROWTH;
+
+  char *buf = (char *)malloc(large_size + 1);
+  if (!buf) return 0;
+  for (size_t i = 0; i < copies * GROWTH; i++)
+    memcpy(buf + size * i, data, size);
+  slex_u64 small = cost(buf, small_size);
+  slex_u64 large = cost(buf, large_size);
+  free(buf);
+
+  *steps_per_byte = (double)large / (double)(large_size + 1);
+  return large > small * GROWTH * 3 / 2 + 4 * FEED_CHUNK;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
+  double steps_per_byte;
+  if (check((const char *)Data, Size, &steps_per_byte))
+    abort();
+  return 0;
+}
+
+#ifdef SLEX_PERF_STANDALONE
+
+static char *read_file(const char *path, size_t *len) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return NULL;
+  fseek(file, 0, SEEK_END);
+  *len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(*len + 1);
+  if (text && fread(text, 1, *len, file) != *len) {
+    free(text);
+    text = NULL;
+  }
+  fclose(file);
+  return text;
+}
+
+// Fragments the random inputs are built from: the starts of every kind of token and the
+// characters that end them, so long and unterminated tokens come up often.
+static const char *fragments[] = {
+  "/*", "*/", "//", "\n", "\\", "\\\n", "\"", "'", "\\x", "\\u", "0x", "0b", "1", "9",
+  ".", "e", "e+", "p", "u", "L", "u8", "a", "_", "#", "# include", "<", ">", "{", "}",
+  "(", ")", "$", "@", "`", " ", "\t", "\xc3\xa9", "\xff", "...", "::", "R\"(", ")\"",
+};
+
+static int run_random(long count, const char *dir) {
+  unsigned long long seed = 0x9e3779b97f4a7c15ull;
+  int flagged = 0;
+  char input[4096];
+
+  for (long n = 0; n < count; n++) {
+    size_t len = 0;
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    int pieces = 1 + (int)((seed >> 33) % 64);
+    for (int i = 0; i < pieces; i++) {
+      seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+      const char *frag = fragments[(seed >> 33) % (sizeof(fragments) / sizeof(*fragments))];
+      size_t frag_len = strlen(frag);
+      int times = (seed >> 20) % 8 == 0 ? 32 : 1;
+      for (int t = 0; t < times && len + frag_len < sizeof(input); t++) {
+        memcpy(input + len, frag, frag_len);
+        len += frag_len;
+      }
+    }
+
+    double steps_per_byte;
+    if (!check(input, len, &steps_per_byte)) continue;
+
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/random-%016llx.c", dir, seed);
+    FILE *file = fopen(path, "wb");
+    if (file) {
+      fwrite(input, 1, len, file);
+      fclose(file);
+    }
+    printf("- Slow input saved to %s (%.1f steps per byte)\n", path, steps_per_byte);
+    flagged++;
+  }
+  return flagged;
+}
+
+int main(int argc, char **argv) {
+  if (argc == 4 && strcmp(argv[1], "-random") == 0)
+    return run_random(atol(argv[2]), argv[3]) ? 1 : 0;
+
+  int failures = 0;
+  double worst = 0;
+  for (int i = 1; i < argc; i++) {
+    size_t len;
+    char *text = read_file(argv[i], &len);
+    if (!text) {
+      printf("- FAILED: cannot read %s\n", argv[i]);
+      failures++;
+      continue;
+    }
+
+    double steps_per_byte;
+    if (check(text, len, &steps_per_byte)) {
+      printf("- FAILED: %s is super-linear (%.1f steps per byte)\n", argv[i], steps_per_byte);
+      failures++;
+    }
+    if (steps_per_byte > worst) worst = steps_per_byte;
+    free(text);
+  }
+
+  if (failures) return 1;
+  printf("+ All %d performance tests passed (at most %.1f steps per byte)\n", argc - 1, worst);
+  return 0;
+}
+
+#endif // SLEX_PERF_STANDALONE
@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+#define SLEX_PIPELINE_IMPLEMENTATION
+#include "../src/slex_pipeline.h"
+
+#define TESTFILE "sample.c"
+#define INPUTFILE "build/pipeline_input.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+// Lexing through the pipeline has to give the same tokens as lexing the whole buffer,
+// no matter where the chunk boundaries fall.
+static void compare(char *text, int len, size_t chunk_size) {
+  SlexContext ctx;
+  SlexPipeline pipe;
+  char store[1024];
+  char pipe_store[1024];
+
+  slex_init_context(&ctx, text, text + len, store, 1024);
+  if (!slex_pipeline_open(&pipe, INPUTFILE, chunk_size, pipe_store, 1024)) {
+    expect(0, "pipeline opens");
+    return;
+  }
+
+  for (;;) {
+    int ok = slex_get_next_token(&ctx);
+    int pipe_ok = slex_pipeline_next_token(&pipe);
+
+    expect(ok == pipe_ok && ctx.tok_ty == pipe.ctx.tok_ty, "same token type");
+    if (ok != pipe_ok || ctx.tok_ty != pipe.ctx.tok_ty) break;
+    if (!ok) {
+      ctx.parse_point++;
+      pipe.ctx.parse_point++;
+      continue;
+    }
+    if (ctx.tok_ty == SLEX_TOK_eof) break;
+
+    int tok_len = ctx.last_tok_char - ctx.first_tok_char + 1;
+    expect(tok_len == pipe.ctx.last_tok_char - pipe.ctx.first_tok_char + 1 &&
+           memcmp(ctx.first_tok_char, pipe.ctx.first_tok_char, tok_len) == 0, "same token text");
+    if (ctx.tok_ty == SLEX_TOK_int_lit)
+      expect(ctx.parsed_int_lit == pipe.ctx.parsed_int_lit, "same int value");
+    if (ctx.tok_ty == SLEX_TOK_str_lit)
+      expect(ctx.str_len == pipe.ctx.str_len && memcmp(store, pipe_store, ctx.str_len) == 0,
+             "same string value");
+  }
+
+  expect(pipe.io_error == 0, "no io error");
+  slex_pipeline_close(&pipe);
+}
+
+int main(void) {
+  FILE *f = fopen(TESTFILE, "rb");
+  char *text = (char *)malloc(1 << 20);
+  int len = f ? (int)fread(text, 1, 1 << 20, f) : -1;
+
+  if (len < 0) {
+    fprintf(stderr, "Error opening file\n");
+    free(text);
+    return 1;
+  }
+
+  fclose(f);
+
+  // a comment and a string longer than the chunks, and some errors
+  const char *extra = "\n/* long comment ........................................... */\n"
+                      "char *s = \"a long string literal that spans several chunks....\";\n"
+                      "x = 1 $ 2 @ 3; y = 0x;\n";
+  memcpy(text + len, extra, strlen(extra));
+  len += (int)strlen(extra);
+
+  f = fopen(INPUTFILE, "wb");
+  fwrite(text, 1, len, f);
+  fclose(f);
+
+  size_t chunk_sizes[] = {1, 7, 64, 4096, 1 << 20};
+  for (size_t i = 0; i < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); i++)
+    compare(text, len, chunk_sizes[i]);
+
+  SlexPipeline pipe;
+  char store[16];
+  expect(!slex_pipeline_open(&pipe, "build/does_not_exist.c", 4096, store, 16) && pipe.io_error,
+         "missing file is reported");
+
+  free(text);
+  if (failures) return 1;
+  printf("+ All pipeline tests passed\n");
+  return 0;
+}
@@ -0,0 +1,179 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+#define SLEX_RING_IMPLEMENTATION
+#include "../src/slex_ring.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+// The tokens of the usual error loop, with the same string store size as the ring.
+static size_t reference(char *text, size_t len, size_t arena_size, SlexRingToken *out, char *values) {
+  SlexContext ctx;
+  char *store = (char *)malloc(arena_size / 2 + 1);
+  size_t n = 0;
+  size_t used = 0;
+
+  slex_init_context(&ctx, text, text + len, store, arena_size / 2);
+  for (;;) {
+    SlexRingToken *t = &out[n++];
+    if (!slex_get_next_token(&ctx)) {
+      t->tok_ty = ctx.tok_ty;
+      t->first_tok_char = ctx.parse_point;
+      if (ctx.parse_point < ctx.stream_end) ctx.parse_point++;
+      continue;
+    }
+    t->tok_ty = ctx.tok_ty;
+    t->first_tok_char = ctx.first_tok_char;
+    t->last_tok_char = ctx.last_tok_char;
+    t->parsed_int_lit = ctx.parsed_int_lit;
+    t->str_len = 0;
+    if (ctx.tok_ty == SLEX_TOK_str_lit || ctx.tok_ty == SLEX_TOK_char_lit) {
+      t->str = values + used;
+      t->str_len = ctx.str_len;
+      memcpy(values + used, store, ctx.str_len);
+      used += ctx.str_len;
+    }
+    if (ctx.tok_ty == SLEX_TOK_eof) break;
+  }
+  free(store);
+  return n;
+}
+
+static int same_token(const SlexRingToken *a, const SlexRingToken *b) {
+  if (a->tok_ty != b->tok_ty || a->first_tok_char != b->first_tok_char) return 0;
+  if (a->tok_ty < SLEX_TOK_eof) return 1;
+  if (a->last_tok_char != b->last_tok_char) return 0;
+  if (a->tok_ty == SLEX_TOK_int_lit) return a->parsed_int_lit == b->parsed_int_lit;
+  if (a->tok_ty == SLEX_TOK_str_lit || a->tok_ty == SLEX_TOK_char_lit)
+    return a->str_len == b->str_len && memcmp(a->str, b->str, a->str_len) == 0;
+  return 1;
+}
+
+// Takes everything out of the ring, holding up to hold batches before releasing them.
+static int compare(char *text, size_t len, size_t token_cap, size_t arena_size, SlexRingWait wait, int hold) {
+  SlexRingToken *expected = (SlexRingToken *)malloc((len + 2) * sizeof(SlexRingToken));
+  char *values = (char *)malloc(len + 1);
+  size_t expected_len = reference(text, len, arena_size, expected, values);
+
+  SlexRing ring;
+  if (!slex_ring_open(&ring, text, text + len, token_cap, arena_size, wait)) {
+    free(values);
+    free(expected);
+    return 0;
+  }
+
+  int same = 1;
+  size_t n = 0;
+  size_t held = 0;
+  int held_batches = 0;
+  SlexRingToken *batch;
+  size_t count;
+  while ((count = slex_ring_acquire(&ring, &batch)) > 0) {
+    for (size_t i = 0; i < count && same; i++)
+      same = n < expected_len && same_token(&batch[i], &expected[n++]);
+    held += count;
+    // the held tokens keep their values while the lexer goes on
+    if (++held_batches > hold || held * 2 > token_cap) {
+      slex_ring_release(&ring, held);
+      held = 0;
+      held_batches = 0;
+    }
+    if (!same) break;
+  }
+  same &= n == expected_len;
+  slex_ring_close(&ring);
+
+  free(values);
+  free(expected);
+  return same;
+}
+
+static void test_sample(char *text, size_t len) {
+  expect(compare(text, len, 4096, 1 << 16, SLEX_RING_BLOCK, 0), "sample.c through a blocking ring");
+  expect(compare(text, len, 4096, 1 << 16, SLEX_RING_SPIN, 0), "sample.c through a spinning ring");
+  // the lexer has to wait for the ring and for the arena all the time
+  expect(compare(text, len, 2, 64, SLEX_RING_BLOCK, 0), "sample.c through a tiny ring");
+  expect(compare(text, len, 8, 40, SLEX_RING_SPIN, 0), "sample.c through a tiny spinning ring");
+  expect(compare(text, len, 256, 1 << 12, SLEX_RING_BLOCK, 3), "sample.c with held batches");
+}
+
+// Errors arrive in order with their location and the lexer goes on after them; an
+// unterminated string runs to the end.
+static void test_errors(void) {
+  char text[] = "a $ b @ 1e+ c \"abc";
+  SlexRingToken expected[16];
+  char values[16];
+
+  expect(compare(text, strlen(text), 4, 256, SLEX_RING_BLOCK, 0), "errors through the ring");
+  size_t n = reference(text, strlen(text), 256, expected, values);
+  expect(n == 8 && expected[1].tok_ty == SLEX_ERR_unknown_tok && *expected[1].first_tok_char == '$' &&
+         expected[4].tok_ty == SLEX_ERR_parse && expected[6].tok_ty == SLEX_ERR_parse &&
+         expected[7].tok_ty == SLEX_TOK_eof, "the errors are tokens");
+}
+
+static void test_stop_early(char *text, size_t len) {
+  SlexRing ring;
+  SlexRingToken *t;
+
+  // closing with a full ring and a waiting lexer
+  for (int wait = 0; wait < 2; wait++) {
+    expect(slex_ring_open(&ring, text, text + len, 4, 64, (SlexRingWait)wait), "ring opens");
+    expect(slex_ring_acquire(&ring, &t) > 0, "first batch");
+    slex_ring_close(&ring);
+  }
+
+  // closing before taking anything
+  expect(slex_ring_open(&ring, text, text + len, 1024, 1 << 12, SLEX_RING_BLOCK), "ring opens");
+  slex_ring_close(&ring);
+}
+
+static void test_empty(void) {
+  char text[] = "";
+  SlexRing ring;
+  SlexRingToken *t;
+
+  expect(slex_ring_open(&ring, text, text, 16, 64, SLEX_RING_BLOCK), "ring opens");
+  expect(slex_ring_acquire(&ring, &t) == 1 && t[0].tok_ty == SLEX_TOK_eof, "empty input gives eof");
+  slex_ring_release(&ring, 1);
+  expect(slex_ring_acquire(&ring, &t) == 0, "and nothing more");
+  slex_ring_close(&ring);
+}
+
+int main(void) {
+  FILE *file = fopen(TESTFILE, "rb");
+  if (!file) {
+    printf("- FAILED: cannot open %s\n", TESTFILE);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) {
+    printf("- FAILED: cannot read %s\n", TESTFILE);
+    return 1;
+  }
+  fclose(file);
+
+  test_sample(text, len);
+  test_errors();
+  test_stop_early(text, len);
+  test_empty();
+  free(text);
+
+  if (failures) return 1;
+  printf("+ All token ring tests passed\n");
+  return 0;
+}
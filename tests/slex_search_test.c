@@ -0,0 +1,201 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+#define SLEX_PIPELINE_IMPLEMENTATION
+#include "../src/slex_pipeline.h"
+
+#define SLEX_SEARCH_IMPLEMENTATION
+#include "../src/slex_search.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+// The identifier tokens spelled name, with the usual error loop.
+static size_t reference(char *text, size_t len, const char *name, char **out) {
+  SlexContext ctx;
+  char store[4096];
+  size_t n = 0;
+  size_t name_len = strlen(name);
+
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  for (;;) {
+    if (!slex_get_next_token(&ctx)) {
+      if (ctx.parse_point >= ctx.stream_end) break;
+      ctx.parse_point++;
+      continue;
+    }
+    if (ctx.tok_ty == SLEX_TOK_eof) break;
+    if (ctx.tok_ty == SLEX_TOK_identifier && (size_t)(ctx.last_tok_char - ctx.first_tok_char + 1) == name_len &&
+        memcmp(ctx.first_tok_char, name, name_len) == 0)
+      out[n++] = ctx.first_tok_char;
+  }
+  return n;
+}
+
+static int compare(char *text, size_t len, const char *name) {
+  char **expected = (char **)malloc((len + 1) * sizeof(char *));
+  size_t expected_len = reference(text, len, name, expected);
+
+  SlexSearch search;
+  slex_search_init(&search, text, text + len, name, strlen(name));
+  size_t n = 0;
+  int same = 1;
+  char *p;
+  while ((p = slex_search_next(&search)) && same) same = n < expected_len && p == expected[n++];
+  same &= n == expected_len && slex_search_next(&search) == NULL;
+  free(expected);
+  return same;
+}
+
+// Every identifier of sample.c is searched for.
+static void test_sample(char *text, size_t len) {
+  SlexContext ctx;
+  char store[4096];
+  char name[256];
+  int same = 1;
+  size_t names = 0;
+
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  while (same && slex_get_next_token(&ctx) && ctx.tok_ty != SLEX_TOK_eof) {
+    size_t name_len = (size_t)(ctx.last_tok_char - ctx.first_tok_char + 1);
+    if (ctx.tok_ty != SLEX_TOK_identifier || name_len >= sizeof(name)) continue;
+    memcpy(name, ctx.first_tok_char, name_len);
+    name[name_len] = '\0';
+    same = compare(text, len, name);
+    names++;
+  }
+  expect(same && names > 50, "every identifier of sample.c is found where the lexer has it");
+}
+
+static void test_cases(void) {
+  char text[] =
+    "x xx _x x1 1x 0x 1.x 1.e5 e5 x.e5 a->x a+x 1e+x 1ex \"x\" \"\\\"x\" x 'x' '\\'' x\n"
+    "// x\n"
+    "/* x */ x /*/ x */ /**/x x/**/ x//x\n"
+    "#define x(y) y + x \\\n"
+    "  x $x @x";
+  char *expected[32];
+  size_t n = reference(text, strlen(text), "x", expected);
+  expect(n == 15, "the cases have 15 uses of x");
+  expect(compare(text, strlen(text), "x"), "uses of x are found");
+  expect(compare(text, strlen(text), "e5"), "uses of e5 are found");
+  expect(compare(text, strlen(text), "xx"), "uses of xx are found");
+
+  SlexSearch search;
+  slex_search_init(&search, text, text + strlen(text), "1x", 2);
+  expect(slex_search_next(&search) == NULL, "a number is not an identifier");
+  slex_search_init(&search, text, text + strlen(text), "x x", 3);
+  expect(slex_search_next(&search) == NULL, "a name with a space is not an identifier");
+  slex_search_init(&search, text, text + strlen(text), "", 0);
+  expect(slex_search_next(&search) == NULL, "the empty name is never found");
+}
+
+static unsigned long long seed = 0x9e3779b97f4a7c15ull;
+
+static unsigned random_below(unsigned n) {
+  seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+  return (unsigned)(seed >> 33) % n;
+}
+
+// Pieces that put names next to numbers, comments and literals.
+static const char *fragments[] = {
+  "/*", "*/", "*", "/", "//", "\n", "\\", "\"", "'", "0", "0x", "0b", "07", "1.", "1.5e", "e+",
+  "3", "u", "ULL", "a", "ab", "_b9", "<", ">", "-", "+", ".", "..", "#", " ", "\t", "\xff", "$",
+  "\\x", "\\x4", "\\u12", "\\U0011ffff", "\\q", "\\'", "\\n",
+  "a.a.a", "e+e+e", "x+x+x", "1.a.1",
+  "\xc3\xa9", "\xce\xb1", "\xcc\x81", "\xc2\xa0", "\xe2\x82\xac", "\xc3",
+};
+
+static void test_random_sources(void) {
+  static const char *names[] = {"a", "ab", "u", "e", "b9", "x", "\xc3\xa9", "a\xce\xb1", "\xce\xb1\xcc\x81"};
+  char buf[256];
+
+  for (int round = 0; round < 20000; round++) {
+    size_t len = 0;
+    int pieces = 1 + (int)random_below(24);
+    for (int i = 0; i < pieces; i++) {
+      const char *frag = fragments[random_below(sizeof(fragments) / sizeof(*fragments))];
+      size_t frag_len = strlen(frag);
+      if (len + frag_len > sizeof(buf)) break;
+      memcpy(buf + len, frag, frag_len);
+      len += frag_len;
+    }
+    for (size_t i = 0; i < sizeof(names) / sizeof(*names); i++) {
+      if (!compare(buf, len, names[i])) {
+        printf("  %.*s\n", (int)len, buf);
+        expect(0, "random source searches like it lexes");
+        return;
+      }
+    }
+  }
+}
+
+// The same file several times over, and one that doesn't exist.
+static void test_files(char *text, size_t len) {
+  const char *paths[] = {TESTFILE, TESTFILE, "does/not/exist.c", TESTFILE, TESTFILE, TESTFILE};
+  size_t count = sizeof(paths) / sizeof(*paths);
+  SlexSearchResult results[sizeof(paths) / sizeof(*paths)];
+  char *expected[1024];
+  size_t expected_len = reference(text, len, "a", expected);
+
+  for (size_t threads = 0; threads < 4; threads++) {
+    slex_search_files(paths, count, "a", 1, threads, results);
+    int same = 1;
+    for (size_t i = 0; i < count; i++) {
+      if (i == 2) {
+        same &= results[i].error == ENOENT && results[i].hit_count == 0;
+        continue;
+      }
+      same &= results[i].error == 0 && results[i].hit_count == expected_len;
+      for (size_t j = 0; j < results[i].hit_count && same; j++) {
+        size_t line, col;
+        SlexContext at;
+        at.first_tok_char = expected[j];
+        slex_get_token_location(&at, text, &line, &col);
+        same = results[i].hits[j].offset == (size_t)(expected[j] - text) &&
+          results[i].hits[j].line_num == line && results[i].hits[j].col_num == col;
+      }
+    }
+    expect(same && expected_len > 0, "files are searched like the buffer");
+    slex_search_free(results, count);
+  }
+}
+
+int main(void) {
+  FILE *file = fopen(TESTFILE, "rb");
+  if (!file) {
+    printf("- FAILED: cannot open %s\n", TESTFILE);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) {
+    printf("- FAILED: cannot read %s\n", TESTFILE);
+    return 1;
+  }
+  fclose(file);
+
+  test_sample(text, len);
+  test_cases();
+  test_random_sources();
+  test_files(text, len);
+  free(text);
+
+  if (failures) return 1;
+  printf("+ All identifier search tests passed\n");
+  return 0;
+}
@@ -0,0 +1,328 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+#define SLEX_SIMD_IMPLEMENTATION
+#include "../src/slex_simd.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+static unsigned long long seed = 0x2545f4914f6cdd1dull;
+
+static unsigned random_below(unsigned n) {
+  seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+  return (unsigned)(seed >> 33) % n;
+}
+
+// The bytes a token can start at, one byte at a time: not whitespace, not in a comment and
+// not after the opening quote of a literal. The closing quotes and the backslashes of escape
+// sequences are the literal ends.
+static void reference_starts(const char *buf, size_t len, slex_bool *starts, slex_bool *ends) {
+  size_t i = 0;
+
+  memset(ends, 0, len * sizeof(*ends));
+
+  while (i < len) {
+    char c = buf[i];
+    if (c == '/' && i + 1 < len && (buf[i + 1] == '/' || buf[i + 1] == '*')) {
+      size_t j = i + 2;
+      if (buf[i + 1] == '/') {
+        while (j < len && buf[j] != '\n') j++;
+      } else {
+        while (j < len && !(buf[j] == '*' && j + 1 < len && buf[j + 1] == '/')) j++;
+        j = j < len ? j + 2 : len;
+      }
+      for (; i < j; i++) starts[i] = 0;
+    } else if (c == '"' || c == '\'') {
+      starts[i++] = 1;
+      while (i < len && buf[i] != c) {
+        starts[i] = 0;
+        if (buf[i] == '\\') {
+          ends[i] = 1;
+          if (i + 1 < len) starts[++i] = 0;
+        }
+        i++;
+      }
+      if (i < len) {
+        ends[i] = 1;
+        starts[i++] = 0;
+      }
+    } else {
+      starts[i] = !slex_simd_is_whitespace(c);
+      i++;
+    }
+  }
+}
+
+// Every stage 1 implementation has to agree with the portable one, whatever the length.
+static void test_index(void) {
+  char buf[512];
+  slex_bool starts[512];
+  slex_bool ends[512];
+  slex_u64 expected[SLEX_SIMD_INDEX_WORDS(512)];
+  slex_u64 got[SLEX_SIMD_INDEX_WORDS(512)];
+  const char alphabet[] = " \t\n\v\f\r\b\x0e\x1f!ab_09AZ@[`{/*\\\"'\x80\x89\xe1\xff";
+
+  for (int round = 0; round < 4000; round++) {
+    size_t len = random_below(sizeof(buf) + 1);
+    for (size_t i = 0; i < len; i++)
+      buf[i] = round % 2 ? (char)random_below(256) : alphabet[random_below(sizeof(alphabet) - 1)];
+
+    slex_simd_index_portable(buf, len, expected);
+    reference_starts(buf, len, starts, ends);
+    for (size_t i = 0; i < len; i++) {
+      slex_bool start = starts[i];
+      slex_bool ident = (buf[i] >= 'a' && buf[i] <= 'z') || (buf[i] >= 'A' && buf[i] <= 'Z') ||
+        (buf[i] >= '0' && buf[i] <= '9') || buf[i] == '_';
+      if (start != (slex_bool)((expected[i / 64 * 3] >> (i % 64)) & 1) ||
+          ident != (slex_bool)((expected[i / 64 * 3 + 1] >> (i % 64)) & 1) ||
+          ends[i] != (slex_bool)((expected[i / 64 * 3 + 2] >> (i % 64)) & 1)) {
+        expect(0, "portable index marks token starts, identifier characters and literal ends");
+        return;
+      }
+    }
+
+    size_t words = SLEX_SIMD_INDEX_WORDS(len);
+#if SLEX_SIMD_X86
+    slex_simd_index_sse2(buf, len, got);
+    expect(memcmp(got, expected, words * 8) == 0, "SSE2 index");
+    if (__builtin_cpu_supports("avx2")) {
+      slex_simd_index_avx2(buf, len, got);
+      expect(memcmp(got, expected, words * 8) == 0, "AVX2 index");
+    }
+    if (__builtin_cpu_supports("avx512bw")) {
+      slex_simd_index_avx512(buf, len, got);
+      expect(memcmp(got, expected, words * 8) == 0, "AVX-512 index");
+    }
+#endif
+    slex_simd_index(buf, len, got);
+    expect(memcmp(got, expected, words * 8) == 0, "dispatched index");
+  }
+}
+
+// Both engines have to give the same tokens, the same values and the same errors.
+static int compare(char *text, size_t len) {
+  SlexContext ctx;
+  SlexSimd simd;
+  char store[64];
+  char simd_store[64];
+  slex_u64 *index = (slex_u64 *)malloc(SLEX_SIMD_INDEX_WORDS(len) * 8 + 8);
+
+  slex_simd_index(text, len, index);
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  slex_simd_init(&simd, text, text + len, index, simd_store, sizeof(simd_store));
+
+  int same = 1;
+  for (;;) {
+    int ok = slex_get_next_token(&ctx);
+    int simd_ok = slex_simd_next_token(&simd);
+    SlexContext *s = &simd.ctx;
+
+    if (ok != simd_ok || ctx.tok_ty != s->tok_ty) {
+      same = 0;
+      break;
+    }
+    if (ok && ctx.tok_ty == SLEX_TOK_eof) break;
+    if (ctx.parse_point - text != s->parse_point - text ||
+        ctx.last_tok_char - text != s->last_tok_char - text) {
+      same = 0;
+      break;
+    }
+    if (!ok) {
+      if (ctx.parse_point >= ctx.stream_end) break;
+      ctx.parse_point++;
+      s->parse_point++;
+      continue;
+    }
+    if (ctx.first_tok_char - text != s->first_tok_char - text ||
+        (ctx.tok_ty == SLEX_TOK_int_lit && ctx.parsed_int_lit != s->parsed_int_lit) ||
+        (ctx.tok_ty == SLEX_TOK_float_lit &&
+         memcmp(&ctx.parsed_float_lit, &s->parsed_float_lit, sizeof(double)) != 0) ||
+        ((ctx.tok_ty == SLEX_TOK_str_lit || ctx.tok_ty == SLEX_TOK_char_lit) &&
+         (ctx.str_len != s->str_len || memcmp(store, simd_store, ctx.str_len) != 0))) {
+      same = 0;
+      break;
+    }
+  }
+  free(index);
+  return same;
+}
+
+// The batches of stage 2 have to hold the tokens of the lexer, whatever their size.
+static int compare_tokenize(char *text, size_t len, size_t token_cap) {
+  SlexContext ctx;
+  SlexSimd simd;
+  SlexToken tokens[16];
+  char store[64];
+  char simd_store[64];
+  slex_u64 *index = (slex_u64 *)malloc(SLEX_SIMD_INDEX_WORDS(len) * 8 + 8);
+
+  slex_simd_index(text, len, index);
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  slex_simd_init(&simd, text, text + len, index, simd_store, sizeof(simd_store));
+
+  int same = 1;
+  for (;;) {
+    size_t count;
+    int done = slex_simd_tokenize(&simd, tokens, token_cap, &count);
+    for (size_t i = 0; i < count && same; i++) {
+      same = slex_get_next_token(&ctx) && ctx.tok_ty == tokens[i].tok_ty &&
+        ctx.first_tok_char == tokens[i].first_tok_char && ctx.last_tok_char == tokens[i].last_tok_char;
+    }
+    if (!same || done) {
+      same = same && done && (!slex_get_next_token(&ctx) || ctx.tok_ty == SLEX_TOK_eof);
+      break;
+    }
+    if (simd.ctx.tok_ty == SLEX_ERR_would_block) {
+      same = count == token_cap;
+      if (!same) break;
+      continue;
+    }
+    // an error: the lexer has it next, and both skip a character
+    if (slex_get_next_token(&ctx) || ctx.tok_ty != simd.ctx.tok_ty || ctx.parse_point != simd.ctx.parse_point) {
+      same = 0;
+      break;
+    }
+    if (ctx.parse_point >= ctx.stream_end) break;
+    ctx.parse_point++;
+    simd.ctx.parse_point++;
+  }
+  free(index);
+  return same;
+}
+
+// A bad escape drops the index for a while, and the rest of the input is back on it.
+static void test_resync(char *text, size_t len) {
+  static const char bad[] = "\"\\q /* \" x */ ";
+  size_t total = sizeof(bad) - 1 + len;
+  char *buf = (char *)malloc(total);
+  slex_u64 *index = (slex_u64 *)malloc(SLEX_SIMD_INDEX_WORDS(total) * 8 + 8);
+  SlexSimd simd;
+  char store[64];
+
+  memcpy(buf, bad, sizeof(bad) - 1);
+  memcpy(buf + sizeof(bad) - 1, text, len);
+  expect(compare(buf, total), "a bad escape lexes the same with both engines");
+  slex_simd_index(buf, total, index);
+  slex_simd_init(&simd, buf, buf + total, index, store, sizeof(store));
+  slex_bool dropped = 0;
+  for (;;) {
+    int ok = slex_simd_next_token(&simd);
+    dropped |= !simd.synced;
+    if (ok ? simd.ctx.tok_ty == SLEX_TOK_eof : simd.ctx.parse_point >= simd.ctx.stream_end) break;
+    if (!ok) simd.ctx.parse_point++;
+  }
+  expect(dropped && simd.synced, "stage 2 goes back to the index after a bad escape");
+  free(index);
+  free(buf);
+}
+
+// Literals around the size of the string store of compare, with and without an escape
+// sequence at the end, where the lexer runs out of room.
+static void test_literal_storage(void) {
+  char buf[96];
+
+  for (size_t n = 60; n <= 68; n++) {
+    for (int escape = 0; escape < 3; escape++) {
+      size_t len = 0;
+      buf[len++] = '"';
+      memset(buf + len, 'a', n);
+      len += n;
+      if (escape) {
+        memcpy(buf + len, escape == 1 ? "\\n" : "\\u00e9", escape == 1 ? 2 : 6);
+        len += escape == 1 ? 2 : 6;
+      }
+      buf[len++] = '"';
+      if (!compare(buf, len)) {
+        printf("  input: %.*s\n", (int)len, buf);
+        expect(0, "literals filling the string store lex the same with both engines");
+        return;
+      }
+    }
+  }
+}
+
+static const char *fragments[] = {
+  "/*", "*/", "//", "\n", "\\", "\"", "'", "\\n", "0x1f", "1.5e+3", "42u", ".", "...",
+  "/* c */", "// c \" '\n", "\"s\\\"t\"", "'\\''", "\"/*\"", "*/*", "/", "1e", "1e+", "\\q",
+  "a", "int", "u8", "L", "#", "<<=", "->", "(", ")", "{", "}", "$", " ", "  ", "\t",
+  "\r\n", "\v", "\f", "        ", "\xc3\xa9", "\xff",
+  // numbers, escape sequences and punctuators stage 2 resolves itself
+  "0", "7", "019", "0b1", "0X", "x", "e", "E", "f", "-", "+", "=", "<", ">", ":", "*", "@", "|",
+  "1234567890123456789", "18446744073709551615", "99999999999999999999", "0xffffffffffffffff",
+  "0x10000000000000000", "3.14159", "0.3", "0.000000000000000000001", "1e-30", "1e400", "2E19",
+  "\\x41", "\\x4", "\\101", "\\u00e9", "\\U0001F600", "\\U00110000", "\\\\",
+  "\"a string long enough to fill the store of the test when it is repeated\"",
+};
+
+static void test_random_sources(void) {
+  char buf[2048];
+
+  for (int round = 0; round < 5000; round++) {
+    size_t len = 0;
+    int pieces = 1 + (int)random_below(200);
+    for (int i = 0; i < pieces; i++) {
+      const char *frag = fragments[random_below(sizeof(fragments) / sizeof(*fragments))];
+      size_t frag_len = strlen(frag);
+      if (len + frag_len > sizeof(buf)) break;
+      memcpy(buf + len, frag, frag_len);
+      len += frag_len;
+    }
+    if (!compare(buf, len)) {
+      printf("  input: %.*s\n", (int)len, buf);
+      expect(0, "random source lexes the same with both engines");
+      return;
+    }
+    if (!compare_tokenize(buf, len, 1 + random_below(16))) {
+      printf("  input: %.*s\n", (int)len, buf);
+      expect(0, "random source tokenizes the same in batches");
+      return;
+    }
+  }
+}
+
+int main(void) {
+  FILE *file = fopen(TESTFILE, "rb");
+  if (!file) {
+    printf("- FAILED: cannot open %s\n", TESTFILE);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) {
+    printf("- FAILED: cannot read %s\n", TESTFILE);
+    return 1;
+  }
+  fclose(file);
+
+  test_index();
+  expect(compare(text, len), "sample.c lexes the same with both engines");
+  // every prefix, so the input ends in every possible place
+  for (size_t i = 0; i <= len; i++) {
+    if (!compare(text, i)) {
+      expect(0, "prefix of sample.c lexes the same with both engines");
+      break;
+    }
+  }
+  expect(compare_tokenize(text, len, 16), "sample.c tokenizes the same in batches");
+  test_resync(text, len);
+  test_literal_storage();
+  test_random_sources();
+  free(text);
+
+  if (failures) return 1;
+  printf("+ All SIMD engine tests passed\n");
+  return 0;
+}
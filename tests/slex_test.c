@@ -25,10 +25,10 @@ int main(int argc, char **argv) {
   slex_init_context(&ctx, text, text + len, store, 1024);
   for (;;) {
     if (!slex_get_next_token(&ctx)) {
-      int ln;
-      int col;
+      size_t ln;
+      size_t col;
       slex_get_parse_ptr_location(&ctx, text, &ln, &col);
-      printf("- An error occured at %d:%d\n", ln, col);
+      printf("- An error occured at %zu:%zu\n", ln, col);
       ctx.parse_point++;
       continue;
     }
@@ -40,7 +40,7 @@ int main(int argc, char **argv) {
     printf("+ Parsed token: %.*s\n", len, ctx.first_tok_char);
 
     if (ctx.tok_ty == SLEX_TOK_str_lit || ctx.tok_ty == SLEX_TOK_char_lit)
-      printf("    Extracted string or char: %.*s\n", ctx.str_len,
+      printf("    Extracted string or char: %.*s\n", (int)ctx.str_len,
              ctx.string_store);
 
     else if (ctx.tok_ty == SLEX_TOK_int_lit)
@@ -49,4 +49,7 @@ int main(int argc, char **argv) {
     else if (ctx.tok_ty == SLEX_TOK_float_lit)
       printf("    Extracted float literal: %f\n", ctx.parsed_float_lit);
   }
+
+  free(text);
+  return 0;
 }
@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#define SLEX_EMIT_TRIVIA 1
+#include "../src/slex.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+static int next_ty(SlexContext *ctx) {
+  return slex_get_next_token(ctx) ? ctx->tok_ty : -1;
+}
+
+int main(void) {
+  SlexContext ctx;
+  char store[1024];
+
+  // Concatenating every token has to give back the input.
+  FILE *f = fopen(TESTFILE, "rb");
+  char *text = (char *)malloc(1 << 20);
+  char *copy = (char *)malloc(1 << 20);
+  int len = f ? (int)fread(text, 1, 1 << 20, f) : -1;
+
+  if (len < 0) {
+    fprintf(stderr, "Error opening file\n");
+    free(text);
+    free(copy);
+    return 1;
+  }
+
+  fclose(f);
+
+  int copy_len = 0;
+  slex_init_context(&ctx, text, text + len, store, 1024);
+  while (slex_get_next_token(&ctx) && ctx.tok_ty != SLEX_TOK_eof) {
+    int tok_len = ctx.last_tok_char - ctx.first_tok_char + 1;
+    expect(ctx.first_tok_char == text + copy_len, "tokens are contiguous");
+    memcpy(copy + copy_len, ctx.first_tok_char, tok_len);
+    copy_len += tok_len;
+  }
+  expect(ctx.tok_ty == SLEX_TOK_eof, "sample lexes without errors");
+  expect(copy_len == len && memcmp(copy, text, len) == 0, "round trip");
+
+  // Doc comments are tagged separately.
+  char doc[] = "/// a\n//// b\n/** c */ /**/ /*** d */ // e";
+  slex_init_context(&ctx, doc, doc + strlen(doc), store, 1024);
+  expect(next_ty(&ctx) == SLEX_TOK_doc_comment, "/// is a doc comment");
+  expect(ctx.last_tok_char - ctx.first_tok_char + 1 == 5, "line comment excludes newline");
+  expect(next_ty(&ctx) == SLEX_TOK_whitespace, "newline");
+  expect(next_ty(&ctx) == SLEX_TOK_comment, "//// is a comment");
+  expect(next_ty(&ctx) == SLEX_TOK_whitespace, "newline");
+  expect(next_ty(&ctx) == SLEX_TOK_doc_comment, "/** is a doc comment");
+  expect(next_ty(&ctx) == SLEX_TOK_whitespace, "space");
+  expect(next_ty(&ctx) == SLEX_TOK_comment, "/**/ is a comment");
+  expect(next_ty(&ctx) == SLEX_TOK_whitespace, "space");
+  expect(next_ty(&ctx) == SLEX_TOK_comment, "/*** is a comment");
+  expect(next_ty(&ctx) == SLEX_TOK_whitespace, "space");
+  expect(next_ty(&ctx) == SLEX_TOK_comment, "trailing comment");
+  expect(next_ty(&ctx) == SLEX_TOK_eof, "eof");
+
+  char unterminated[] = "a /* b";
+  slex_init_context(&ctx, unterminated, unterminated + strlen(unterminated), store, 1024);
+  expect(next_ty(&ctx) == SLEX_TOK_identifier, "identifier");
+  expect(next_ty(&ctx) == SLEX_TOK_whitespace, "space");
+  expect(next_ty(&ctx) == -1 && ctx.tok_ty == SLEX_ERR_parse, "unterminated comment");
+
+  free(text);
+  free(copy);
+  if (failures) return 1;
+  printf("+ All trivia tests passed\n");
+  return 0;
+}
@@ -0,0 +1,314 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#define SLEX_IMPLEMENTATION
+#include "../src/slex.h"
+
+#define SLEX_PREFIX slex_padded_
+#define SLEX_PADDED_INPUT 1
+#include "../src/slex.h"
+
+#define SLEX_SIMD_IMPLEMENTATION
+#include "../src/slex_simd.h"
+
+#define TESTFILE "sample.c"
+
+static int failures = 0;
+
+static void expect(int cond, const char *what) {
+  if (!cond) {
+    printf("- FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+// The tokens of the usual error loop as "i:text" (identifiers), "e:text" (errors, from
+// first_tok_char to parse_point) or "t" (anything else), separated by spaces.
+static void describe(const char *text, char *out, size_t out_len) {
+  SlexContext ctx;
+  char store[256];
+  size_t n = 0;
+
+  out[0] = '\0';
+  slex_init_context(&ctx, (char *)text, (char *)text + strlen(text), store, sizeof(store));
+  for (;;) {
+    int ok = slex_get_next_token(&ctx);
+    if (ok && ctx.tok_ty == SLEX_TOK_eof) break;
+    if (!ok && ctx.parse_point >= ctx.stream_end) break;
+    char *first = ctx.first_tok_char;
+    char *last = ok ? ctx.last_tok_char : ctx.parse_point;
+    if (ok && ctx.tok_ty == SLEX_TOK_identifier)
+      n += (size_t)snprintf(out + n, out_len - n, "%si:%.*s", n ? " " : "", (int)(last - first + 1), first);
+    else if (!ok)
+      n += (size_t)snprintf(out + n, out_len - n, "%se:%.*s", n ? " " : "", (int)(last - first + 1), first);
+    else
+      n += (size_t)snprintf(out + n, out_len - n, "%st", n ? " " : "");
+    if (!ok) ctx.parse_point++;
+  }
+}
+
+static void expect_tokens(const char *text, const char *expected) {
+  char got[512];
+  describe(text, got, sizeof(got));
+  if (strcmp(got, expected) != 0) {
+    printf("  %s: got \"%s\", expected \"%s\"\n", text, got, expected);
+    expect(0, "UTF-8 source lexes as expected");
+  }
+}
+
+static void test_identifiers(void) {
+  expect_tokens("\xc3\xa9t\xc3\xa9 = \xce\xb1\xce\xb2;", "i:\xc3\xa9t\xc3\xa9 t i:\xce\xb1\xce\xb2 t");
+  expect_tokens("\xe6\x97\xa5\xe6\x9c\xac(x)", "i:\xe6\x97\xa5\xe6\x9c\xac t i:x t");
+  // U+1D465 MATHEMATICAL ITALIC SMALL X, four bytes
+  expect_tokens("\xf0\x9d\x91\xa5_1", "i:\xf0\x9d\x91\xa5_1");
+  // U+0301 COMBINING ACUTE ACCENT continues an identifier but can't start one
+  expect_tokens("e\xcc\x81", "i:e\xcc\x81");
+  expect_tokens("\xcc\x81x", "e:\xcc\x81 i:x");
+  // U+00B7 MIDDLE DOT is XID_Continue, U+00D7 MULTIPLICATION SIGN isn't
+  expect_tokens("a\xc2\xb7" "b a\xc3\x97" "b", "i:a\xc2\xb7" "b i:a e:\xc3\x97 i:b");
+  // emoji aren't identifier characters
+  expect_tokens("a\xf0\x9f\x98\x80" "b", "i:a e:\xf0\x9f\x98\x80 i:b");
+  // literals and comments keep their UTF-8 as before
+  expect_tokens("\"\xc3\xa9\" /* \xe2\x82\xac */ '\xce\xb1'", "t t");
+}
+
+// A run of non-ASCII characters that aren't identifier characters is one error, invalid
+// UTF-8 included, and it stops before an identifier or ASCII.
+static void test_error_runs(void) {
+  expect_tokens("\xe2\x82\xac\xe2\x82\xac\xc2\xa0 x", "e:\xe2\x82\xac\xe2\x82\xac\xc2\xa0 i:x");
+  expect_tokens("\xff\xfe\xc0\xaf;", "e:\xff\xfe\xc0\xaf t");
+  expect_tokens("\xe2\x82\xac\xce\xb1", "e:\xe2\x82\xac i:\xce\xb1");
+  // a surrogate, a code point above U+10FFFF and overlong forms don't decode
+  expect_tokens("\xed\xa0\x80", "e:\xed\xa0\x80");
+  expect_tokens("\xf4\x90\x80\x80", "e:\xf4\x90\x80\x80");
+  expect_tokens("\xe0\x80\xa9", "e:\xe0\x80\xa9");
+  expect_tokens("a\xc3", "i:a e:\xc3");
+  expect_tokens("\xce", "e:\xce");
+  expect_tokens("\xce\xb1\xce", "i:\xce\xb1 e:\xce");
+
+  // a long run costs one call
+  size_t len = 3 * 100000;
+  char *text = (char *)malloc(len + 3);
+  for (size_t i = 0; i < len; i += 3) memcpy(text + i, "\xe2\x82\xac", 3);
+  memcpy(text + len, " x", 3);
+
+  SlexContext ctx;
+  slex_init_context(&ctx, text, text + len + 2, NULL, 0);
+  expect(!slex_get_next_token(&ctx) && ctx.tok_ty == SLEX_ERR_unknown_tok && ctx.first_tok_char == text &&
+         ctx.parse_point == text + len - 1, "the run is one error ending at its last byte");
+  ctx.parse_point++;
+  expect(slex_get_next_token(&ctx) && ctx.tok_ty == SLEX_TOK_identifier && *ctx.first_tok_char == 'x',
+         "lexing goes on after the run");
+  free(text);
+}
+
+static unsigned long long seed = 0x9e3779b97f4a7c15ull;
+
+static unsigned random_below(unsigned n) {
+  seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+  return (unsigned)(seed >> 33) % n;
+}
+
+static const char *fragments[] = {
+  "a", "_", "1", "1.", "e+", "0x", " ", "\n", "\"", "'", "/*", "*/", "//", "\\", "u8", "L",
+  "\xc3\xa9", "\xce\xb1", "\xcc\x81", "\xc2\xb7", "\xc3\x97", "\xe6\x97\xa5", "\xe2\x82\xac",
+  "\xf0\x9d\x91\xa5", "\xf0\x9f\x98\x80", "\xff", "\xc3", "\xe6\x97", "\xed\xa0\x80", "\xc0\xaf",
+};
+
+static size_t random_source(char *buf, size_t cap) {
+  size_t len = 0;
+  int pieces = 1 + (int)random_below(24);
+  for (int i = 0; i < pieces; i++) {
+    const char *frag = fragments[random_below(sizeof(fragments) / sizeof(*fragments))];
+    size_t frag_len = strlen(frag);
+    if (len + frag_len > cap) break;
+    memcpy(buf + len, frag, frag_len);
+    len += frag_len;
+  }
+  return len;
+}
+
+typedef struct {
+  int tok_ty;
+  size_t first;
+  size_t last;
+} Tok;
+
+// The usual error loop; errors are recorded from first_tok_char to parse_point.
+static size_t lex_all(int (*get)(SlexContext *), char *text, size_t len, Tok *out) {
+  SlexContext ctx;
+  char store[256];
+  size_t n = 0;
+
+  slex_init_context(&ctx, text, text + len, store, sizeof(store));
+  for (;;) {
+    int ok = get(&ctx);
+    if (ok && ctx.tok_ty == SLEX_TOK_eof) break;
+    if (!ok && ctx.parse_point >= ctx.stream_end) break;
+    out[n].tok_ty = ctx.tok_ty;
+    out[n].first = (size_t)(ctx.first_tok_char - text);
+    out[n].last = (size_t)((ok ? ctx.last_tok_char : ctx.parse_point) - text);
+    n++;
+    if (!ok) ctx.parse_point++;
+  }
+  return n;
+}
+
+// The same tokens with the input arriving in two parts, split at cut.
+static size_t lex_partial(char *text, size_t len, size_t cut, Tok *out) {
+  SlexContext ctx;
+  char store[256];
+  size_t n = 0;
+
+  slex_init_context(&ctx, text, text + cut, store, sizeof(store));
+  ctx.stream_is_partial = 1;
+  for (;;) {
+    int ok = slex_get_next_token(&ctx);
+    if (!ok && ctx.tok_ty == SLEX_ERR_need_input) {
+      ctx.stream_end = text + len;
+      ctx.stream_is_partial = 0;
+      continue;
+    }
+    if (ok && ctx.tok_ty == SLEX_TOK_eof) break;
+    if (!ok && ctx.parse_point >= ctx.stream_end) break;
+    out[n].tok_ty = ctx.tok_ty;
+    out[n].first = (size_t)(ctx.first_tok_char - text);
+    out[n].last = (size_t)((ok ? ctx.last_tok_char : ctx.parse_point) - text);
+    n++;
+    if (!ok) ctx.parse_point++;
+  }
+  return n;
+}
+
+static int same_tokens(const Tok *a, size_t a_len, const Tok *b, size_t b_len) {
+  if (a_len != b_len) return 0;
+  for (size_t i = 0; i < a_len; i++) {
+    if (a[i].tok_ty != b[i].tok_ty || a[i].first != b[i].first || a[i].last != b[i].last) return 0;
+  }
+  return 1;
+}
+
+// Random UTF-8 lexes the same padded, and split anywhere into a partial stream.
+static void test_random_sources(void) {
+  char buf[256];
+  Tok expected[256];
+  Tok got[256];
+
+  for (int round = 0; round < 20000; round++) {
+    size_t len = random_source(buf, sizeof(buf) - SLEX_PADDING);
+    size_t expected_len = lex_all(slex_get_next_token, buf, len, expected);
+
+    char padded[256];
+    memcpy(padded, buf, len);
+    memset(padded + len, 0, SLEX_PADDING);
+    if (!same_tokens(expected, expected_len, got, lex_all(slex_padded_get_next_token, padded, len, got))) {
+      printf("  %.*s\n", (int)len, buf);
+      expect(0, "random UTF-8 lexes the same padded");
+      return;
+    }
+
+    size_t cut = random_below((unsigned)len + 1);
+    if (!same_tokens(expected, expected_len, got, lex_partial(buf, len, cut, got))) {
+      printf("  %.*s (cut at %zu)\n", (int)len, buf, cut);
+      expect(0, "random UTF-8 lexes the same as a partial stream");
+      return;
+    }
+  }
+}
+
+// Decodes code points, unlike slex_simd_validate_utf8's byte ranges.
+static size_t reference_validate(const unsigned char *p, size_t len) {
+  size_t i = 0;
+  while (i < len) {
+    unsigned c = p[i];
+    size_t n;
+    unsigned cp;
+    if (c < 0x80) {
+      i++;
+      continue;
+    }
+    if ((c & 0xE0) == 0xC0) { n = 2; cp = c & 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { n = 3; cp = c & 0x0F; }
+    else if ((c & 0xF8) == 0xF0) { n = 4; cp = c & 0x07; }
+    else return i;
+    if (len - i < n) return i;
+    for (size_t k = 1; k < n; k++) {
+      if ((p[i + k] & 0xC0) != 0x80) return i;
+      cp = cp << 6 | (p[i + k] & 0x3F);
+    }
+    unsigned min = n == 2 ? 0x80 : n == 3 ? 0x800 : 0x10000;
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return i;
+    i += n;
+  }
+  return len;
+}
+
+static void test_validate(char *sample, size_t sample_len) {
+  expect(slex_simd_validate_utf8(sample, sample_len) == sample_len, "sample.c is valid");
+  expect(slex_simd_validate_utf8("", 0) == 0, "empty input is valid");
+
+  // an error at every position of a long input, so it is found in blocks and in the tail
+  static const char *bad[] = {"\xff", "\x80", "\xc0\xaf", "\xe0\x80\xaf", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xf5", "\xe2\x82"};
+  char buf[200];
+  for (size_t b = 0; b < sizeof(bad) / sizeof(*bad); b++) {
+    size_t bad_len = strlen(bad[b]);
+    for (size_t at = 0; at + bad_len <= sizeof(buf); at++) {
+      memset(buf, 'a', sizeof(buf));
+      memcpy(buf + at, bad[b], bad_len);
+      // "\xe2\x82" is only cut off when the input ends there
+      size_t len = b == 7 ? at + bad_len : sizeof(buf);
+      if (slex_simd_validate_utf8(buf, len) != at) {
+        printf("  %s at %zu\n", bad[b], at);
+        expect(0, "the invalid sequence is found");
+        return;
+      }
+    }
+  }
+
+  // random mixes of valid sequences and random bytes
+  static const char *pieces[] = {"a", " ", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\xed\x9f\xbf",
+    "\xee\x80\x80", "\xf4\x8f\xbf\xbf", "\xf0\x90\x80\x80", "\xe0\xa0\x80", "\xc2\x80"};
+  unsigned char text[512];
+  for (int round = 0; round < 50000; round++) {
+    size_t len = 0;
+    size_t target = random_below(sizeof(text) - 4);
+    while (len < target) {
+      const char *piece = pieces[random_below(sizeof(pieces) / sizeof(*pieces))];
+      memcpy(text + len, piece, strlen(piece));
+      len += strlen(piece);
+    }
+    int corrupt = (int)random_below(4);
+    for (int i = 0; i < corrupt && len; i++) text[random_below((unsigned)len)] = (unsigned char)random_below(256);
+    if (slex_simd_validate_utf8((const char *)text, len) != reference_validate(text, len)) {
+      expect(0, "random input validates like the reference");
+      return;
+    }
+  }
+}
+
+int main(void) {
+  FILE *file = fopen(TESTFILE, "rb");
+  if (!file) {
+    printf("- FAILED: cannot open %s\n", TESTFILE);
+    return 1;
+  }
+  fseek(file, 0, SEEK_END);
+  size_t len = (size_t)ftell(file);
+  rewind(file);
+  char *text = (char *)malloc(len);
+  if (fread(text, 1, len, file) != len) {
+    printf("- FAILED: cannot read %s\n", TESTFILE);
+    return 1;
+  }
+  fclose(file);
+
+  test_identifiers();
+  test_error_runs();
+  test_random_sources();
+  test_validate(text, len);
+  free(text);
+
+  if (failures) return 1;
+  printf("+ All UTF-8 tests passed\n");
+  return 0;
+}
@@ -0,0 +1,500 @@
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
+a $ b @ c `
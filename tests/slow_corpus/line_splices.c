@@ -0,0 +1,3000 @@
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
+a\
@@ -0,0 +1,2 @@
+/* comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text comment text */
+int x;
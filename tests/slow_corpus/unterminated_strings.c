@@ -0,0 +1,2000 @@
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
+"abc
@@ -0,0 +1 @@
+0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 0x 0b 0x. 0e 
\ No newline at end of file